@@ -13,6 +13,7 @@
 #include "base/ranges/algorithm.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/test/bind.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/values_test_util.h"
 #include "brave/browser/brave_wallet/json_rpc_service_factory.h"
@@ -1208,6 +1209,92 @@ TEST_F(KeyringServiceUnitTest, UnlockResumesDefaultKeyring) {
   }
 }
 
+TEST_F(KeyringServiceUnitTest, UnlockIsAsyncAndRecordsDuration) {
+  base::HistogramTester histogram_tester;
+  {
+    KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    ASSERT_TRUE(CreateWallet(&service, "brave"));
+  }
+
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(service.IsLocked(mojom::kDefaultKeyringId));
+
+  bool unlocked = false;
+  base::RunLoop run_loop;
+  service.Unlock("brave", base::BindLambdaForTesting([&](bool success) {
+                   unlocked = success;
+                   run_loop.Quit();
+                 }));
+  // Key derivation happens off the calling sequence.
+  EXPECT_TRUE(service.IsLocked(mojom::kDefaultKeyringId));
+  run_loop.Run();
+
+  EXPECT_TRUE(unlocked);
+  EXPECT_FALSE(service.IsLocked(mojom::kDefaultKeyringId));
+  histogram_tester.ExpectTotalCount("Brave.Wallet.UnlockDuration", 1);
+
+  // Failed attempts are not recorded.
+  service.Lock();
+  EXPECT_FALSE(Unlock(&service, "brave123"));
+  histogram_tester.ExpectTotalCount("Brave.Wallet.UnlockDuration", 1);
+}
+
+TEST_F(KeyringServiceUnitTest, LockWhileUnlockIsPending) {
+  {
+    KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    ASSERT_TRUE(CreateWallet(&service, "brave"));
+  }
+
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  absl::optional<bool> unlocked;
+  service.Unlock("brave", base::BindLambdaForTesting(
+                              [&](bool success) { unlocked = success; }));
+  service.Lock();
+  EXPECT_EQ(unlocked, false);
+
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(service.IsLocked(mojom::kDefaultKeyringId));
+  EXPECT_TRUE(service.IsLockedSync());
+
+  // Reset drops a pending unlock as well.
+  unlocked.reset();
+  service.Unlock("brave", base::BindLambdaForTesting(
+                              [&](bool success) { unlocked = success; }));
+  service.Reset();
+  EXPECT_EQ(unlocked, false);
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(service.IsKeyringCreated(mojom::kDefaultKeyringId));
+
+  // The service unlocks normally afterwards.
+  ASSERT_TRUE(CreateWallet(&service, "brave"));
+  service.Lock();
+  EXPECT_TRUE(Unlock(&service, "brave"));
+}
+
+TEST_F(KeyringServiceUnitTest, ConcurrentUnlockIsRejected) {
+  {
+    KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    ASSERT_TRUE(CreateWallet(&service, "brave"));
+  }
+
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  absl::optional<bool> first;
+  absl::optional<bool> second;
+  base::RunLoop run_loop;
+  service.Unlock("brave", base::BindLambdaForTesting([&](bool success) {
+                   first = success;
+                   run_loop.Quit();
+                 }));
+  service.Unlock("brave", base::BindLambdaForTesting(
+                              [&](bool success) { second = success; }));
+  EXPECT_EQ(second, false);
+  EXPECT_FALSE(first);
+
+  run_loop.Run();
+  EXPECT_EQ(first, true);
+  EXPECT_FALSE(service.IsLocked(mojom::kDefaultKeyringId));
+}
+
 TEST_F(KeyringServiceUnitTest, GetMnemonicForDefaultKeyring) {
   // Needed to skip unnecessary migration in CreateEncryptorForKeyring.
   GetPrefs()->SetBoolean(kBraveWalletKeyringEncryptionKeysMigrated, true);
@@ -4444,6 +4531,7 @@ TEST_F(KeyringServiceUnitTest, DevWalletPassword) {
   {
     cmdline->AppendSwitchASCII(switches::kDevWalletPassword, "some_password");
     KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    task_environment_.RunUntilIdle();
     EXPECT_FALSE(service.IsLocked(mojom::kDefaultKeyringId));
     cmdline->RemoveSwitch(switches::kDevWalletPassword);
   }
@@ -4452,6 +4540,7 @@ TEST_F(KeyringServiceUnitTest, DevWalletPassword) {
   {
     cmdline->AppendSwitchASCII(switches::kDevWalletPassword, "wrong_password");
     KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    task_environment_.RunUntilIdle();
     EXPECT_TRUE(service.IsLocked(mojom::kDefaultKeyringId));
     cmdline->RemoveSwitch(switches::kDevWalletPassword);
   }
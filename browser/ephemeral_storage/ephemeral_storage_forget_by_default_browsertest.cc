@@ -5,7 +5,11 @@
 
 #include "brave/browser/ephemeral_storage/ephemeral_storage_browsertest.h"
 
+#include "base/strings/stringprintf.h"
+#include "brave/browser/ephemeral_storage/ephemeral_storage_service_factory.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/ephemeral_storage/ephemeral_storage_pref_names.h"
+#include "brave/components/ephemeral_storage/ephemeral_storage_service.h"
 #include "chrome/browser/content_settings/cookie_settings_factory.h"
 #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -13,6 +17,7 @@
 #include "chrome/test/base/ui_test_utils.h"
 #include "components/content_settings/core/browser/cookie_settings.h"
 #include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/prefs/pref_service.h"
 #include "content/public/test/browser_test.h"
 #include "net/base/features.h"
 
@@ -317,6 +322,48 @@ IN_PROC_BROWSER_TEST_F(EphemeralStorageForgetByDefaultIsDefaultBrowserTest,
   EXPECT_EQ(0u, GetAllCookies().size());
 }
 
+IN_PROC_BROWSER_TEST_F(EphemeralStorageForgetByDefaultIsDefaultBrowserTest,
+                       ManyOriginsAreCleanedUpTogether) {
+  constexpr int kOriginsCount = 10000;
+  auto* service = EphemeralStorageServiceFactory::GetForContext(
+      browser()->profile());
+  ASSERT_TRUE(service);
+  PrefService* prefs = browser()->profile()->GetPrefs();
+
+  std::vector<url::Origin> origins;
+  for (int i = 0; i < kOriginsCount; ++i) {
+    origins.push_back(url::Origin::Create(
+        GURL(base::StringPrintf("https://site%d.test/", i))));
+    service->FirstPartyStorageAreaNotInUse(origins.back());
+  }
+  // Duplicate notifications don't queue an origin twice.
+  service->FirstPartyStorageAreaNotInUse(origins[0]);
+  EXPECT_EQ(
+      prefs->GetList(ephemeral_storage::kFirstPartyStorageOriginsToCleanup)
+          .size(),
+      static_cast<size_t>(kOriginsCount));
+
+  // Origins used again are not cleaned up.
+  service->FirstPartyStorageAreaInUse(origins[1]);
+  service->FirstPartyStorageAreaInUse(origins[2]);
+
+  WaitForCleanupAfterKeepAlive();
+  EXPECT_TRUE(
+      prefs->GetList(ephemeral_storage::kFirstPartyStorageOriginsToCleanup)
+          .empty());
+
+  // Not in use again, so queued with a new keep alive.
+  service->FirstPartyStorageAreaNotInUse(origins[1]);
+  EXPECT_EQ(
+      prefs->GetList(ephemeral_storage::kFirstPartyStorageOriginsToCleanup)
+          .size(),
+      1u);
+  WaitForCleanupAfterKeepAlive();
+  EXPECT_TRUE(
+      prefs->GetList(ephemeral_storage::kFirstPartyStorageOriginsToCleanup)
+          .empty());
+}
+
 class EphemeralStorageForgetByDefaultDisabledBrowserTest
     : public EphemeralStorageBrowserTest {
  public:
@@ -125,21 +125,4 @@ TEST_F(IpfsNetwrokUtilsUnitTest, CreateRequestForTextTest) {
   run_loop.Run();
 }
 
-TEST_F(IpfsNetwrokUtilsUnitTest, CreateRequestForFolderTest) {
-  base::ScopedTempDir dir;
-  ASSERT_TRUE(dir.CreateUniqueTempDir());
-  std::string content = "test\n\rmultiline\n\rcontent";
-  std::string filename = "test_name";
-  CreateCustomTestFile(dir.GetPath(), filename, content);
-  std::string mime_type = "test/type";
-  std::string mime_boundary = "mime_boundary";
-  base::RunLoop run_loop;
-  auto upload_callback =
-      base::BindOnce(&IpfsNetwrokUtilsUnitTest::ValidateRequest,
-                     base::Unretained(this), run_loop.QuitClosure());
-  CreateRequestForFolder(dir.GetPath(), blob_getter_factory(),
-                         std::move(upload_callback));
-  run_loop.Run();
-}
-
 }  // namespace ipfs
@@ -5,14 +5,16 @@
 
 #include "brave/browser/net/brave_query_filter.h"
 
+#include <iterator>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/fixed_flat_set.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_piece.h"
-#include "base/strings/string_split.h"
-#include "base/strings/string_util.h"
+#include "brave/components/url_sanitizer/browser/query_string_utils.h"
 #include "third_party/re2/src/re2/re2.h"
 #include "url/gurl.h"
 
@@ -74,49 +76,51 @@ static constexpr auto kScopedQueryStringTrackers =
         {"ref_url", "twitter.com"},
     });
 
-// Remove tracking query parameters from a GURL, leaving all
-// other parts untouched.
-absl::optional<std::string> StripQueryParameter(const base::StringPiece& query,
-                                                const std::string& spec) {
-  // We are using custom query string parsing code here. See
-  // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
-  // for more information on why this approach was selected.
-  //
-  // Split query string by ampersands, remove tracking parameters,
-  // then join the remaining query parameters, untouched, back into
-  // a single query string.
-  const std::vector<base::StringPiece> input_kv_strings =
-      SplitStringPiece(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
-  std::vector<base::StringPiece> output_kv_strings;
-  int disallowed_count = 0;
-  for (const auto& kv_string : input_kv_strings) {
-    const std::vector<base::StringPiece> pieces = SplitStringPiece(
-        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-    const base::StringPiece& key = pieces.empty() ? "" : pieces[0];
-    if (pieces.size() >= 2 &&
-        (kSimpleQueryStringTrackers.count(key) == 1 ||
-         (kScopedQueryStringTrackers.count(key) == 1 &&
-          GURL(spec).DomainIs(kScopedQueryStringTrackers.at(key).data())) ||
-         (kConditionalQueryStringTrackers.count(key) == 1 &&
-          !re2::RE2::PartialMatch(
-              spec, kConditionalQueryStringTrackers.at(key).data())))) {
-      ++disallowed_count;
-    } else {
-      output_kv_strings.push_back(kv_string);
-    }
+// Returns the compiled pattern of the conditional tracker at |it|. The
+// patterns are compiled once, on first use.
+const re2::RE2& GetConditionalTrackerRegex(
+    decltype(kConditionalQueryStringTrackers)::const_iterator it) {
+  static const base::NoDestructor<std::vector<std::unique_ptr<re2::RE2>>>
+      kRegexes([] {
+        std::vector<std::unique_ptr<re2::RE2>> regexes;
+        for (const auto& tracker : kConditionalQueryStringTrackers) {
+          regexes.push_back(std::make_unique<re2::RE2>(tracker.second.data()));
+        }
+        return regexes;
+      }());
+  return *(*kRegexes)[std::distance(kConditionalQueryStringTrackers.begin(),
+                                    it)];
+}
+
+bool IsTracker(base::StringPiece key, const GURL& url) {
+  if (kSimpleQueryStringTrackers.contains(key)) {
+    return true;
   }
-  if (disallowed_count > 0) {
-    return base::JoinString(output_kv_strings, "&");
+  const auto scoped = kScopedQueryStringTrackers.find(key);
+  if (scoped != kScopedQueryStringTrackers.end()) {
+    return url.DomainIs(scoped->second);
   }
-  return absl::nullopt;
+  const auto conditional = kConditionalQueryStringTrackers.find(key);
+  if (conditional != kConditionalQueryStringTrackers.end()) {
+    return !re2::RE2::PartialMatch(url.spec(),
+                                   GetConditionalTrackerRegex(conditional));
+  }
+  return false;
+}
+
+// Remove tracking query parameters from a GURL, leaving all
+// other parts untouched.
+absl::optional<std::string> StripQueryParameter(base::StringPiece query,
+                                                const GURL& url) {
+  return brave::StripQueryTrackers(
+      query, [&url](base::StringPiece key) { return IsTracker(key, url); });
 }
 
 }  // namespace
 
 absl::optional<GURL> ApplyQueryFilter(const GURL& original_url) {
   const auto& query = original_url.query_piece();
-  const std::string& spec = original_url.spec();
-  const auto clean_query_value = StripQueryParameter(query, spec);
+  const auto clean_query_value = StripQueryParameter(query, original_url);
   if (!clean_query_value.has_value())
     return absl::nullopt;
   const auto& clean_query = clean_query_value.value();
@@ -25,3 +25,30 @@ TEST(BraveQueryFilter, FilterQueryTrackers) {
   EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/")));
   EXPECT_FALSE(ApplyQueryFilter(GURL()));
 }
+
+TEST(BraveQueryFilter, KeepsOtherParameters) {
+  EXPECT_EQ(ApplyQueryFilter(GURL(
+                "https://test.com/?a=1&&fbclid=1&b&=c&gclid=2&d=4#gclid=3")),
+            GURL("https://test.com/?a=1&&b&=c&d=4#gclid=3"));
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://test.com/?&fbclid=1&a=1")),
+            GURL("https://test.com/?&a=1"));
+  // Keys and values have to be non empty.
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/?fbclid=&gclid")));
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://test.com/?=fbclid=1&a==1")),
+            GURL("https://test.com/?a==1"));
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/?a=fbclid")));
+}
+
+TEST(BraveQueryFilter, ScopedAndConditionalTrackers) {
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://www.instagram.com/p/?igshid=1")),
+            GURL("https://www.instagram.com/p/"));
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/p/?igshid=1")));
+  EXPECT_EQ(
+      ApplyQueryFilter(GURL("https://twitter.com/?ref_src=1&ref_url=2&a=b")),
+      GURL("https://twitter.com/?a=b"));
+  EXPECT_FALSE(
+      ApplyQueryFilter(GURL("https://test.com/emailWebview?mkt_tok=123")));
+  EXPECT_EQ(
+      ApplyQueryFilter(GURL("https://test.com/emailwebview?mkt_tok=123")),
+      GURL("https://test.com/emailwebview"));
+}
@@ -13,6 +13,7 @@
 #include "base/timer/timer.h"
 #include "brave/browser/playlist/playlist_service_factory.h"
 #include "brave/components/playlist/browser/media_detector_component_manager.h"
+#include "brave/components/playlist/browser/playlist_data_source.h"
 #include "brave/components/playlist/browser/playlist_constants.h"
 #include "brave/components/playlist/browser/playlist_service_observer.h"
 #include "brave/components/playlist/browser/pref_names.h"
@@ -177,6 +178,21 @@ class PlaylistServiceUnitTest : public testing::Test {
     return item;
   }
 
+  // Returns |count| items named "1", "2", ... with distinct media sources.
+  std::vector<mojom::PlaylistItemPtr> GetItemsWithDistinctMedia(size_t count) {
+    std::vector<mojom::PlaylistItemPtr> items;
+    for (size_t i = 0; i < count; i++) {
+      auto item = mojom::PlaylistItem::New();
+      item->id = base::Token::CreateRandom().ToString();
+      item->page_source = GURL("https://foo.com/");
+      item->media_source = GURL("https://media.src/" + item->id);
+      item->media_path = item->media_source;
+      item->name = base::NumberToString(i + 1);
+      items.push_back(std::move(item));
+    }
+    return items;
+  }
+
   mojom::PlaylistPtr GetPlaylist(const std::string& id) {
     auto* playlist_value = prefs()->GetDict(kPlaylistsPref).FindDict(id);
     if (!playlist_value)
@@ -1176,6 +1192,161 @@ TEST_F(PlaylistServiceUnitTest, RemoveItemFromPlaylist) {
   }
 }
 
+TEST_F(PlaylistServiceUnitTest, AddItemsAlreadyInPlaylist) {
+  auto* service = playlist_service();
+
+  const std::vector<std::string> item_ids = {"id1", "id2", "id3"};
+  for (const auto& id : item_ids) {
+    auto dummy_item = mojom::PlaylistItem::New();
+    dummy_item->id = id;
+    dummy_item->media_source = GURL("http://" + id + "/media");
+    service->UpdatePlaylistItemValue(
+        id, base::Value(ConvertPlaylistItemToValue(dummy_item)));
+  }
+  ASSERT_TRUE(service->AddItemsToPlaylist(kDefaultPlaylistID, {"id1", "id2"}));
+
+  // Adding items already in the playlist along with a new one should only
+  // append the new one, keeping the existing order.
+  EXPECT_TRUE(
+      service->AddItemsToPlaylist(kDefaultPlaylistID, {"id2", "id3", "id1"}));
+
+  auto playlist = GetPlaylist(kDefaultPlaylistID);
+  ASSERT_TRUE(playlist);
+  std::vector<std::string> stored_ids;
+  base::ranges::transform(playlist->items, std::back_inserter(stored_ids),
+                          [](const auto& item) { return item->id; });
+  EXPECT_EQ(item_ids, stored_ids);
+
+  for (const auto& id : item_ids) {
+    service->GetPlaylistItem(
+        id, base::BindLambdaForTesting([](mojom::PlaylistItemPtr item) {
+          EXPECT_EQ(std::vector<std::string>{kDefaultPlaylistID},
+                    item->parents);
+        }));
+  }
+}
+
+TEST_F(PlaylistServiceUnitTest, RemoveAndReorderItemsFromPlaylist) {
+  auto* service = playlist_service();
+
+  const std::vector<std::string> item_ids = {"id1", "id2", "id3", "id4"};
+  for (const auto& id : item_ids) {
+    auto dummy_item = mojom::PlaylistItem::New();
+    dummy_item->id = id;
+    dummy_item->media_source = GURL("http://" + id + "/media");
+    service->UpdatePlaylistItemValue(
+        id, base::Value(ConvertPlaylistItemToValue(dummy_item)));
+  }
+  ASSERT_TRUE(service->AddItemsToPlaylist(kDefaultPlaylistID, item_ids));
+
+  auto get_stored_ids = [&]() {
+    std::vector<std::string> stored_ids;
+    base::ranges::transform(GetPlaylist(kDefaultPlaylistID)->items,
+                            std::back_inserter(stored_ids),
+                            [](const auto& item) { return item->id; });
+    return stored_ids;
+  };
+
+  service->RemoveItemFromPlaylist(kDefaultPlaylistID, "id2");
+  EXPECT_EQ((std::vector<std::string>{"id1", "id3", "id4"}), get_stored_ids());
+  EXPECT_FALSE(prefs()->GetDict(kPlaylistItemsPref).FindDict("id2"));
+
+  // Positions are of the playlist after the removal.
+  service->ReorderItemFromPlaylist(kDefaultPlaylistID, "id4", 0);
+  EXPECT_EQ((std::vector<std::string>{"id4", "id1", "id3"}), get_stored_ids());
+
+  service->ReorderItemFromPlaylist(kDefaultPlaylistID, "id1", 2);
+  EXPECT_EQ((std::vector<std::string>{"id4", "id3", "id1"}), get_stored_ids());
+
+  service->RemoveItemFromPlaylist(kDefaultPlaylistID, "id4");
+  EXPECT_EQ((std::vector<std::string>{"id3", "id1"}), get_stored_ids());
+}
+
+TEST_F(PlaylistServiceUnitTest, RenamePlaylist) {
+  auto* service = playlist_service();
+
+  std::string playlist_id;
+  service->CreatePlaylist(
+      mojom::Playlist::New(),
+      base::BindLambdaForTesting([&](mojom::PlaylistPtr new_list) {
+        playlist_id = new_list->id.value_or(std::string());
+      }));
+  ASSERT_FALSE(playlist_id.empty());
+
+  auto dummy_item = mojom::PlaylistItem::New();
+  dummy_item->id = "id1";
+  dummy_item->media_source = GURL("http://id1/media");
+  service->UpdatePlaylistItemValue(
+      dummy_item->id, base::Value(ConvertPlaylistItemToValue(dummy_item)));
+  ASSERT_TRUE(service->AddItemsToPlaylist(playlist_id, {dummy_item->id}));
+
+  bool called = false;
+  service->RenamePlaylist(
+      playlist_id, "new name",
+      base::BindLambdaForTesting([&](mojom::PlaylistPtr playlist) {
+        called = true;
+        EXPECT_EQ("new name", playlist->name);
+        ASSERT_EQ(1u, playlist->items.size());
+        EXPECT_EQ("id1", playlist->items.front()->id);
+      }));
+  EXPECT_TRUE(called);
+
+  // The name is stored and the items are left as they were.
+  auto playlist = GetPlaylist(playlist_id);
+  ASSERT_TRUE(playlist);
+  EXPECT_EQ("new name", playlist->name);
+  ASSERT_EQ(1u, playlist->items.size());
+  EXPECT_EQ("id1", playlist->items.front()->id);
+}
+
+TEST_F(PlaylistServiceUnitTest, RejectDuplicatedMedia) {
+  auto* service = playlist_service();
+
+  auto make_item = [](const std::string& id, const std::string& media_source) {
+    auto item = mojom::PlaylistItem::New();
+    item->id = id;
+    item->page_source = GURL("https://foo.com/");
+    item->media_source = item->media_path = GURL(media_source);
+    return item;
+  };
+  auto add_item = [&](mojom::PlaylistItemPtr item) {
+    std::vector<mojom::PlaylistItemPtr> items;
+    items.push_back(std::move(item));
+    service->AddMediaFilesFromItems(kDefaultPlaylistID, /*cache*/ false,
+                                    std::move(items));
+  };
+  auto has_item = [&](const std::string& id) {
+    return !!prefs()->GetDict(kPlaylistItemsPref).FindDict(id);
+  };
+
+  add_item(make_item("id1", "https://media.src/1"));
+  ASSERT_TRUE(has_item("id1"));
+
+  // Media that is already in the library is skipped.
+  add_item(make_item("id2", "https://media.src/1"));
+  EXPECT_FALSE(has_item("id2"));
+  EXPECT_EQ(1u, GetPlaylist(kDefaultPlaylistID)->items.size());
+
+  // Once the item's media source changes, the old one can be added again and
+  // the new one is rejected.
+  service->UpdateItem(make_item("id1", "https://media.src/2"));
+  add_item(make_item("id2", "https://media.src/2"));
+  EXPECT_FALSE(has_item("id2"));
+  add_item(make_item("id3", "https://media.src/1"));
+  EXPECT_TRUE(has_item("id3"));
+
+  // Deleting an item allows its media to be added again.
+  service->RemoveItemFromPlaylist(kDefaultPlaylistID, "id1");
+  ASSERT_FALSE(has_item("id1"));
+  add_item(make_item("id4", "https://media.src/2"));
+  EXPECT_TRUE(has_item("id4"));
+
+  // Resetting clears the media sources along with the items.
+  service->DeleteAllPlaylistItems();
+  add_item(make_item("id5", "https://media.src/1"));
+  EXPECT_TRUE(has_item("id5"));
+}
+
 TEST_F(PlaylistServiceUnitTest, ResetAll) {
   // Pre-condition: data and preferences are changed
   auto* service = playlist_service();
@@ -1300,6 +1471,75 @@ TEST_F(PlaylistServiceUnitTest, ResetAll) {
       service->GetPlaylistItemDirPath(item->id)));
 }
 
+TEST_F(PlaylistServiceUnitTest, ConcurrentMediaDownloads) {
+  auto* service = playlist_service();
+  auto* download_manager = service->media_file_download_manager_.get();
+  download_manager->pause_download_for_testing_ = true;
+  const size_t max_downloads = download_manager->max_concurrent_downloads_;
+  ASSERT_GT(max_downloads, 1u);
+
+  std::vector<mojom::PlaylistItemPtr> items =
+      GetItemsWithDistinctMedia(max_downloads + 2);
+  const std::string first_id = items.front()->id;
+  service->AddMediaFilesFromItems(kDefaultPlaylistID, /* cache = */ true,
+                                  std::move(items));
+
+  // Downloads start up to the limit, the rest wait in the queue.
+  WaitUntil(base::BindLambdaForTesting([&]() {
+    return download_manager->current_jobs_.size() == max_downloads;
+  }));
+  EXPECT_EQ(download_manager->pending_media_file_creation_jobs_.size(), 2u);
+
+  // Canceling a download starts the next pending one.
+  download_manager->CancelDownloadRequest(first_id);
+  EXPECT_EQ(download_manager->current_jobs_.size(), max_downloads);
+  EXPECT_FALSE(download_manager->current_jobs_.contains(first_id));
+  EXPECT_EQ(download_manager->pending_media_file_creation_jobs_.size(), 1u);
+
+  download_manager->CancelAllDownloadRequests();
+  EXPECT_FALSE(download_manager->has_download_requests());
+  EXPECT_TRUE(download_manager->pending_media_file_creation_jobs_.empty());
+}
+
+TEST_F(PlaylistServiceUnitTest, DuplicatedMediaDownloadDoesNotBlockQueue) {
+  auto* service = playlist_service();
+  auto* download_manager = service->media_file_download_manager_.get();
+  download_manager->pause_download_for_testing_ = true;
+  const size_t max_downloads = download_manager->max_concurrent_downloads_;
+  ASSERT_GT(max_downloads, 1u);
+
+  std::vector<mojom::PlaylistItemPtr> items =
+      GetItemsWithDistinctMedia(max_downloads + 1);
+  auto first_item = items.front()->Clone();
+  const std::string second_id = items[1]->id;
+  const std::string last_id = items.back()->id;
+  service->AddMediaFilesFromItems(kDefaultPlaylistID, /* cache = */ true,
+                                  std::move(items));
+  WaitUntil(base::BindLambdaForTesting([&]() {
+    return download_manager->current_jobs_.size() == max_downloads;
+  }));
+  ASSERT_EQ(download_manager->pending_media_file_creation_jobs_.size(), 1u);
+
+  // Request the first item again, ahead of the last one in the queue.
+  auto duplicated_job =
+      std::make_unique<PlaylistMediaFileDownloadManager::DownloadJob>();
+  duplicated_job->item = first_item.Clone();
+  download_manager->pending_media_file_creation_jobs_.push_front(
+      std::move(duplicated_job));
+
+  // A free slot goes to the last item, the duplicated request keeps waiting
+  // for the download of the first item.
+  download_manager->CancelDownloadRequest(second_id);
+  EXPECT_EQ(download_manager->current_jobs_.size(), max_downloads);
+  EXPECT_TRUE(download_manager->current_jobs_.contains(last_id));
+  const auto& pending_jobs =
+      download_manager->pending_media_file_creation_jobs_;
+  ASSERT_EQ(pending_jobs.size(), 1u);
+  EXPECT_EQ(pending_jobs.front()->item->id, first_item->id);
+
+  download_manager->CancelAllDownloadRequests();
+}
+
 TEST_F(PlaylistServiceUnitTest, CleanUpOrphanedPlaylistItemDirs) {
   // Pre-condition: There's orphaned dirs. -------------------------------------
   auto* service = playlist_service();
@@ -1339,6 +1579,44 @@ TEST_F(PlaylistServiceUnitTest, CleanUpOrphanedPlaylistItemDirs) {
       service->GetPlaylistItemDirPath(item.id)));
 }
 
+TEST_F(PlaylistServiceUnitTest, DataSourceServesMediaFile) {
+  auto* service = playlist_service();
+  const std::string id = base::Token::CreateRandom().ToString();
+  base::FilePath media_path;
+  ASSERT_TRUE(service->GetMediaPath(id, &media_path));
+  ASSERT_TRUE(base::CreateDirectory(media_path.DirName()));
+  // Bigger than a page, so the mapping spans several of them.
+  std::string content(64 * 1024, 'a');
+  content.back() = 'z';
+  ASSERT_TRUE(base::WriteFile(media_path, content));
+
+  PlaylistDataSource data_source(service);
+  auto request_data = [&](const std::string& url) {
+    scoped_refptr<base::RefCountedMemory> data;
+    base::RunLoop run_loop;
+    data_source.StartDataRequest(
+        GURL(url), content::WebContents::Getter(),
+        base::BindLambdaForTesting(
+            [&](scoped_refptr<base::RefCountedMemory> result) {
+              data = std::move(result);
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    return data;
+  };
+
+  auto data = request_data("chrome-untrusted://playlist-data/" + id +
+                           "/media/");
+  ASSERT_TRUE(data);
+  ASSERT_EQ(data->size(), content.size());
+  EXPECT_EQ(std::string(data->front_as<char>(), data->size()), content);
+
+  // Missing files are reported as failures.
+  EXPECT_FALSE(request_data("chrome-untrusted://playlist-data/" +
+                            base::Token::CreateRandom().ToString() +
+                            "/media/"));
+}
+
 class PlaylistServiceWithFakeUAUnitTest : public PlaylistServiceUnitTest {
  public:
   PlaylistServiceWithFakeUAUnitTest()
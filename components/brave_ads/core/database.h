@@ -8,7 +8,9 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
 #include "base/memory/memory_pressure_listener.h"
 #include "base/memory/weak_ptr.h"
@@ -17,6 +19,7 @@
 #include "brave/components/brave_ads/core/export.h"
 #include "sql/database.h"
 #include "sql/meta_table.h"
+#include "sql/statement.h"
 
 namespace brave_ads {
 
@@ -53,6 +56,10 @@ class ADS_EXPORT Database final {
   mojom::DBCommandResponseInfo::StatusType Migrate(int32_t version,
                                                    int32_t compatible_version);
 
+  // Returns a reset statement compiled from |sql|, reusing a previously
+  // compiled statement if possible, or nullptr if |sql| is invalid.
+  sql::Statement* GetCachedStatement(const std::string& sql);
+
   void OnErrorCallback(int error, sql::Statement* statement);
 
   void OnMemoryPressure(
@@ -63,6 +70,11 @@ class ADS_EXPORT Database final {
   sql::MetaTable meta_table_;
   bool is_initialized_ = false;
 
+  // Compiled statements keyed by their SQL, so statements which are run over
+  // and over, i.e. reads while serving ads, are only compiled once.
+  base::LRUCache</*sql*/ std::string, std::unique_ptr<sql::Statement>>
+      statements_;
+
   std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 
   SEQUENCE_CHECKER(sequence_checker_);
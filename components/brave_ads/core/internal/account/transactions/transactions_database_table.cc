@@ -197,16 +197,17 @@ void Transactions::GetForDateRange(const base::Time from_time,
                                    GetTransactionsCallback callback) const {
   const std::string query = base::ReplaceStringPlaceholders(
       "SELECT id, created_at, creative_instance_id, segment, value, ad_type, "
-      "confirmation_type, reconciled_at FROM $1 WHERE created_at BETWEEN $2 "
-      "and $3",
-      {GetTableName(), TimeAsTimestampString(from_time),
-       TimeAsTimestampString(to_time)},
-      nullptr);
+      "confirmation_type, reconciled_at FROM $1 WHERE created_at BETWEEN ? "
+      "and ?",
+      {GetTableName()}, nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
   command->type = mojom::DBCommandInfo::Type::READ;
   command->command = query;
 
+  BindDouble(command.get(), 0, from_time.ToDoubleT());
+  BindDouble(command.get(), 1, to_time.ToDoubleT());
+
   command->record_bindings = {
       mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // id
       mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // created_at
@@ -19,44 +19,29 @@ namespace brave_ads::targeting::model {
 
 namespace {
 
-constexpr uint16_t kSignalLevel = 1;
 constexpr size_t kMaximumSegments = 3;
 
-uint16_t CalculateScoreForHistory(
-    const PurchaseIntentSignalHistoryList& history) {
-  uint16_t score = 0;
-
-  const base::TimeDelta time_window = kPurchaseIntentTimeWindow.Get();
-
-  for (const auto& signal_segment : history) {
-    const base::Time signal_decayed_time =
-        signal_segment.created_at + time_window;
-
-    if (base::Time::Now() > signal_decayed_time) {
-      continue;
-    }
-
-    score += kSignalLevel * signal_segment.weight;
-  }
-
-  return score;
-}
-
 }  // namespace
 
 SegmentList PurchaseIntent::GetSegments() const {
   SegmentList segments;
 
+  ClientStateManager* const client_state_manager =
+      ClientStateManager::GetInstance();
+
   const PurchaseIntentSignalHistoryMap& purchase_intent_signal_history =
-      ClientStateManager::GetInstance()->GetPurchaseIntentSignalHistory();
+      client_state_manager->GetPurchaseIntentSignalHistory();
 
   if (purchase_intent_signal_history.empty()) {
     return segments;
   }
 
+  // Scores are cached per segment, so the signal history is only walked for
+  // segments with new or expired signals.
   std::multimap<uint16_t, std::string> scores;
   for (const auto& [segment, history] : purchase_intent_signal_history) {
-    const uint16_t score = CalculateScoreForHistory(history);
+    const uint16_t score =
+        client_state_manager->GetPurchaseIntentScoreForSegment(segment);
     scores.insert(std::make_pair(score, segment));
   }
 
@@ -5,8 +5,6 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_classification/text_classification_model.h"
 
-#include <string>
-
 #include "base/check.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_classification/text_classification_alias.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
@@ -17,42 +15,6 @@ namespace brave_ads::targeting::model {
 
 namespace {
 
-SegmentProbabilityMap GetSegmentProbabilities(
-    const TextClassificationProbabilityList&
-        text_classification_probabilities) {
-  SegmentProbabilityMap segment_probabilities;
-
-  for (const auto& probabilities : text_classification_probabilities) {
-    for (const auto& [segment, page_score] : probabilities) {
-      DCHECK(!segment.empty());
-
-      const auto iter = segment_probabilities.find(segment);
-      if (iter == segment_probabilities.cend()) {
-        segment_probabilities.insert({segment, page_score});
-      } else {
-        iter->second += page_score;
-      }
-    }
-  }
-
-  return segment_probabilities;
-}
-
-SegmentProbabilityList ToSortedSegmentProbabilityList(
-    const SegmentProbabilityMap& segment_probabilities) {
-  const int count = segment_probabilities.size();
-  SegmentProbabilityList list(count);
-
-  std::partial_sort_copy(
-      segment_probabilities.cbegin(), segment_probabilities.cend(),
-      list.begin(), list.end(),
-      [](const SegmentProbabilityPair& lhs, const SegmentProbabilityPair& rhs) {
-        return lhs.second > rhs.second;
-      });
-
-  return list;
-}
-
 SegmentList ToSegmentList(const SegmentProbabilityList& segment_probabilities) {
   SegmentList segments;
 
@@ -68,24 +30,18 @@ SegmentList ToSegmentList(const SegmentProbabilityList& segment_probabilities) {
 }  // namespace
 
 SegmentList TextClassification::GetSegments() const {
-  const TextClassificationProbabilityList& probabilities =
+  const SegmentProbabilityList& segment_probabilities =
       ClientStateManager::GetInstance()
-          ->GetTextClassificationProbabilitiesHistory();
+          ->GetTextClassificationSegmentProbabilities();
 
-  if (probabilities.empty()) {
+  if (segment_probabilities.empty()) {
     BLOG(1, "No text classification probabilities found for "
                 << brave_l10n::GetDefaultLocaleString() << " locale");
 
     return {};
   }
 
-  const SegmentProbabilityMap segment_probabilities =
-      GetSegmentProbabilities(probabilities);
-
-  const SegmentProbabilityList sorted_segment_probabilities =
-      ToSortedSegmentProbabilityList(segment_probabilities);
-
-  return ToSegmentList(sorted_segment_probabilities);
+  return ToSegmentList(segment_probabilities);
 }
 
 }  // namespace brave_ads::targeting::model
@@ -169,6 +169,8 @@ void AdsImpl::Shutdown(ShutdownCallback callback) {
 
   NotificationAdManager::GetInstance()->RemoveAll();
 
+  ClientStateManager::GetInstance()->Flush();
+
   std::move(callback).Run(/*success*/ true);
 }
 
@@ -17,7 +17,6 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_table_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
-#include "brave/components/brave_ads/core/internal/common/time/time_formatting_util.h"
 
 namespace brave_ads::database::table {
 
@@ -125,13 +124,15 @@ void Conversions::GetAll(GetConversionsCallback callback) const {
   const std::string query = base::ReplaceStringPlaceholders(
       "SELECT ac.creative_set_id, ac.type, ac.url_pattern, "
       "ac.advertiser_public_key, ac.observation_window, ac.expiry_timestamp "
-      "FROM $1 AS ac WHERE $2 < expiry_timestamp",
-      {GetTableName(), TimeAsTimestampString(base::Time::Now())}, nullptr);
+      "FROM $1 AS ac WHERE ? < expiry_timestamp",
+      {GetTableName()}, nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
   command->type = mojom::DBCommandInfo::Type::READ;
   command->command = query;
 
+  BindDouble(command.get(), 0, base::Time::Now().ToDoubleT());
+
   command->record_bindings = {
       mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
       mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // type
@@ -154,13 +155,14 @@ void Conversions::PurgeExpired(ResultCallback callback) const {
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   const std::string query = base::ReplaceStringPlaceholders(
-      "DELETE FROM $1 WHERE $2 >= expiry_timestamp",
-      {GetTableName(), TimeAsTimestampString(base::Time::Now())}, nullptr);
+      "DELETE FROM $1 WHERE ? >= expiry_timestamp", {GetTableName()}, nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::EXECUTE;
+  command->type = mojom::DBCommandInfo::Type::RUN;
   command->command = query;
 
+  BindDouble(command.get(), 0, base::Time::Now().ToDoubleT());
+
   transaction->commands.push_back(std::move(command));
 
   AdsClientHelper::GetInstance()->RunDBTransaction(
@@ -23,7 +23,6 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_table_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
-#include "brave/components/brave_ads/core/internal/common/time/time_formatting_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/campaigns_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ads_database_table.h"
@@ -407,10 +406,9 @@ void CreativeInlineContentAds::GetForSegmentsAndDimensions(
       "ca.creative_instance_id = cbna.creative_instance_id INNER JOIN "
       "geo_targets AS gt ON gt.campaign_id = cbna.campaign_id INNER JOIN "
       "dayparts AS dp ON dp.campaign_id = cbna.campaign_id WHERE s.segment IN "
-      "$2 AND cbna.dimensions = '$3' AND $4 BETWEEN cam.start_at_timestamp AND "
+      "$2 AND cbna.dimensions = ? AND ? BETWEEN cam.start_at_timestamp AND "
       "cam.end_at_timestamp",
-      {GetTableName(), BuildBindingParameterPlaceholder(segments.size()),
-       dimensions, TimeAsTimestampString(base::Time::Now())},
+      {GetTableName(), BuildBindingParameterPlaceholder(segments.size())},
       nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
@@ -423,6 +421,11 @@ void CreativeInlineContentAds::GetForSegmentsAndDimensions(
     index++;
   }
 
+  BindString(command.get(), index, dimensions);
+  index++;
+
+  BindDouble(command.get(), index, base::Time::Now().ToDoubleT());
+
   command->record_bindings = {
       mojom::DBCommandInfo::RecordBindingType::
           STRING_TYPE,  // creative_instance_id
@@ -484,14 +487,16 @@ void CreativeInlineContentAds::GetForDimensions(
       "ca.creative_instance_id = cbna.creative_instance_id INNER JOIN "
       "geo_targets AS gt ON gt.campaign_id = cbna.campaign_id INNER JOIN "
       "dayparts AS dp ON dp.campaign_id = cbna.campaign_id AND cbna.dimensions "
-      "= '$2' AND $3 BETWEEN cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), dimensions, TimeAsTimestampString(base::Time::Now())},
-      nullptr);
+      "= ? AND ? BETWEEN cam.start_at_timestamp AND cam.end_at_timestamp",
+      {GetTableName()}, nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
   command->type = mojom::DBCommandInfo::Type::READ;
   command->command = query;
 
+  BindString(command.get(), 0, dimensions);
+  BindDouble(command.get(), 1, base::Time::Now().ToDoubleT());
+
   command->record_bindings = {
       mojom::DBCommandInfo::RecordBindingType::
           STRING_TYPE,  // creative_instance_id
@@ -547,14 +552,16 @@ void CreativeInlineContentAds::GetAll(
       "cbna.creative_set_id INNER JOIN creative_ads AS ca ON "
       "ca.creative_instance_id = cbna.creative_instance_id INNER JOIN "
       "geo_targets AS gt ON gt.campaign_id = cbna.campaign_id INNER JOIN "
-      "dayparts AS dp ON dp.campaign_id = cbna.campaign_id WHERE $2 BETWEEN "
+      "dayparts AS dp ON dp.campaign_id = cbna.campaign_id WHERE ? BETWEEN "
       "cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), TimeAsTimestampString(base::Time::Now())}, nullptr);
+      {GetTableName()}, nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
   command->type = mojom::DBCommandInfo::Type::READ;
   command->command = query;
 
+  BindDouble(command.get(), 0, base::Time::Now().ToDoubleT());
+
   command->record_bindings = {
       mojom::DBCommandInfo::RecordBindingType::
           STRING_TYPE,  // creative_instance_id
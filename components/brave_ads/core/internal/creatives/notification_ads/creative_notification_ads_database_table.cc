@@ -5,10 +5,8 @@
 
 #include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_database_table.h"
 
-#include <map>
 #include <utility>
 
-#include "base/containers/contains.h"
 #include "base/functional/bind.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
@@ -21,22 +19,19 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/common/strings/string_conversions_util.h"
-#include "brave/components/brave_ads/core/internal/common/time/time_formatting_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/campaigns_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ads_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/dayparts_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/embeddings_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/geo_targets_database_table.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
 #include "brave/components/brave_ads/core/internal/creatives/segments_database_table.h"
 #include "brave/components/brave_ads/core/internal/segments/segment_util.h"
 #include "url/gurl.h"
 
 namespace brave_ads::database::table {
 
-using CreativeNotificationAdMap =
-    std::map</*creative_instance_id*/ std::string, CreativeNotificationAdInfo>;
-
 namespace {
 
 constexpr char kTableName[] = "creative_ad_notifications";
@@ -101,90 +96,151 @@ CreativeNotificationAdInfo GetFromRecord(mojom::DBRecordInfo* record) {
   return creative_ad;
 }
 
-CreativeNotificationAdMap GroupCreativeAdsFromResponse(
-    mojom::DBCommandResponseInfoPtr command_response) {
-  DCHECK(command_response);
+void OnLoadSnapshot(mojom::DBCommandResponseInfoPtr command_response) {
+  CreativeNotificationAdsSnapshot* const snapshot =
+      CreativeNotificationAdsSnapshot::GetInstance();
 
-  CreativeNotificationAdMap creative_ads;
+  if (!command_response ||
+      command_response->status !=
+          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+    BLOG(0, "Failed to load creative notification ads");
+    return snapshot->DidLoad(/*success*/ false, /*creative_ads*/ {});
+  }
 
+  // Records are not grouped by creative instance, the snapshot merges the geo
+  // targets and dayparts of each campaign.
+  CreativeNotificationAdList creative_ads;
   for (const auto& record : command_response->result->get_records()) {
-    const CreativeNotificationAdInfo creative_ad = GetFromRecord(record.get());
+    creative_ads.push_back(GetFromRecord(record.get()));
+  }
 
-    const auto iter = creative_ads.find(creative_ad.creative_instance_id);
-    if (iter == creative_ads.cend()) {
-      creative_ads.insert({creative_ad.creative_instance_id, creative_ad});
-      continue;
-    }
+  snapshot->DidLoad(/*success*/ true, creative_ads);
+}
 
-    // Creative instance already exists, so append new geo targets and dayparts
-    // to the existing creative ad
-    for (const auto& geo_target : creative_ad.geo_targets) {
-      const auto geo_target_iter = iter->second.geo_targets.find(geo_target);
-      if (geo_target_iter == iter->second.geo_targets.cend()) {
-        iter->second.geo_targets.insert(geo_target);
-      }
-    }
+// Runs |callback| once the snapshot has been loaded, reading the creative ads
+// from the database the first time.
+void MaybeLoadSnapshot(const std::string& table_name,
+                       CreativeNotificationAdsSnapshot::LoadCallback callback) {
+  CreativeNotificationAdsSnapshot* const snapshot =
+      CreativeNotificationAdsSnapshot::GetInstance();
+  if (snapshot->IsLoaded()) {
+    return std::move(callback).Run(/*success*/ true);
+  }
 
-    for (const auto& daypart : creative_ad.dayparts) {
-      if (!base::Contains(iter->second.dayparts, daypart)) {
-        iter->second.dayparts.push_back(daypart);
-      }
-    }
+  if (!snapshot->AddLoadCallback(std::move(callback))) {
+    // Already loading.
+    return;
   }
 
-  return creative_ads;
-}
+  // Expired campaigns are included, the snapshot filters them when serving.
+  const std::string query = base::ReplaceStringPlaceholders(
+      "SELECT can.creative_instance_id, can.creative_set_id, can.campaign_id, "
+      "cam.start_at_timestamp, cam.end_at_timestamp, cam.daily_cap, "
+      "cam.advertiser_id, cam.priority, ca.conversion, ca.per_day, "
+      "ca.per_week, ca.per_month, ca.total_max, ca.value, ca.split_test_group, "
+      "s.segment, e.embedding, gt.geo_target, ca.target_url, can.title, "
+      "can.body, cam.ptr, dp.dow, dp.start_minute, dp.end_minute FROM $1 AS "
+      "can INNER JOIN campaigns AS cam ON cam.campaign_id = can.campaign_id "
+      "INNER JOIN segments AS s ON s.creative_set_id = can.creative_set_id "
+      "LEFT JOIN embeddings AS e ON e.creative_set_id = can.creative_set_id "
+      "INNER JOIN creative_ads AS ca ON ca.creative_instance_id = "
+      "can.creative_instance_id INNER JOIN geo_targets AS gt ON gt.campaign_id "
+      "= can.campaign_id INNER JOIN dayparts AS dp ON dp.campaign_id = "
+      "can.campaign_id",
+      {table_name}, nullptr);
 
-CreativeNotificationAdList GetCreativeAdsFromResponse(
-    mojom::DBCommandResponseInfoPtr command_response) {
-  DCHECK(command_response);
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::READ;
+  command->command = query;
 
-  const CreativeNotificationAdMap grouped_creative_ads =
-      GroupCreativeAdsFromResponse(std::move(command_response));
+  command->record_bindings = {
+      mojom::DBCommandInfo::RecordBindingType::
+          STRING_TYPE,  // creative_instance_id
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
+      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // split_test_group
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // embedding
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // title
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // body
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
+      mojom::DBCommandInfo::RecordBindingType::
+          INT_TYPE,  // dayparts->start_minute
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE  // dayparts->end_minute
+  };
 
-  CreativeNotificationAdList creative_ads;
-  for (const auto& [creative_instance_id, creative_ad] : grouped_creative_ads) {
-    creative_ads.push_back(creative_ad);
-  }
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+  transaction->commands.push_back(std::move(command));
 
-  return creative_ads;
+  AdsClientHelper::GetInstance()->RunDBTransaction(
+      std::move(transaction), base::BindOnce(&OnLoadSnapshot));
 }
 
 void OnGetForSegments(const SegmentList& segments,
                       GetCreativeNotificationAdsCallback callback,
-                      mojom::DBCommandResponseInfoPtr command_response) {
-  if (!command_response ||
-      command_response->status !=
-          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+                      const bool success) {
+  if (!success) {
     BLOG(0, "Failed to get creative notification ads");
     return std::move(callback).Run(/*success*/ false, segments,
                                    /*creative_ads*/ {});
   }
 
   const CreativeNotificationAdList creative_ads =
-      GetCreativeAdsFromResponse(std::move(command_response));
+      CreativeNotificationAdsSnapshot::GetInstance()->GetForSegments(
+          segments, base::Time::Now());
 
   std::move(callback).Run(/*success*/ true, segments, creative_ads);
 }
 
 void OnGetAll(GetCreativeNotificationAdsCallback callback,
-              mojom::DBCommandResponseInfoPtr command_response) {
-  if (!command_response ||
-      command_response->status !=
-          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+              const bool success) {
+  if (!success) {
     BLOG(0, "Failed to get all creative notification ads");
     return std::move(callback).Run(/*success*/ false, /*segments*/ {},
                                    /*creative_ads*/ {});
   }
 
   const CreativeNotificationAdList creative_ads =
-      GetCreativeAdsFromResponse(std::move(command_response));
+      CreativeNotificationAdsSnapshot::GetInstance()->GetAll(
+          base::Time::Now());
 
   const SegmentList segments = GetSegments(creative_ads);
 
   std::move(callback).Run(/*success*/ true, segments, creative_ads);
 }
 
+void OnSave(const CreativeNotificationAdList& creative_ads,
+            ResultCallback callback,
+            const bool success) {
+  if (success) {
+    CreativeNotificationAdsSnapshot::GetInstance()->Update(creative_ads);
+  }
+
+  std::move(callback).Run(success);
+}
+
+void OnDelete(ResultCallback callback, const bool success) {
+  if (success) {
+    CreativeNotificationAdsSnapshot::GetInstance()->Clear();
+  }
+
+  std::move(callback).Run(success);
+}
+
 void MigrateToV24(mojom::DBTransactionInfo* transaction) {
   DCHECK(transaction);
 
@@ -253,7 +309,9 @@ void CreativeNotificationAds::Save(
 
   AdsClientHelper::GetInstance()->RunDBTransaction(
       std::move(transaction),
-      base::BindOnce(&OnResultCallback, std::move(callback)));
+      base::BindOnce(&OnResultCallback,
+                     base::BindOnce(&OnSave, creative_ads,
+                                    std::move(callback))));
 }
 
 void CreativeNotificationAds::Delete(ResultCallback callback) const {
@@ -263,7 +321,8 @@ void CreativeNotificationAds::Delete(ResultCallback callback) const {
 
   AdsClientHelper::GetInstance()->RunDBTransaction(
       std::move(transaction),
-      base::BindOnce(&OnResultCallback, std::move(callback)));
+      base::BindOnce(&OnResultCallback,
+                     base::BindOnce(&OnDelete, std::move(callback))));
 }
 
 void CreativeNotificationAds::GetForSegments(
@@ -274,131 +333,14 @@ void CreativeNotificationAds::GetForSegments(
                                    /*creative_ads*/ {});
   }
 
-  const std::string query = base::ReplaceStringPlaceholders(
-      "SELECT can.creative_instance_id, can.creative_set_id, can.campaign_id, "
-      "cam.start_at_timestamp, cam.end_at_timestamp, cam.daily_cap, "
-      "cam.advertiser_id, cam.priority, ca.conversion, ca.per_day, "
-      "ca.per_week, ca.per_month, ca.total_max, ca.value, ca.split_test_group, "
-      "s.segment, e.embedding, gt.geo_target, ca.target_url, can.title, "
-      "can.body, cam.ptr, dp.dow, dp.start_minute, dp.end_minute FROM $1 AS "
-      "can INNER JOIN campaigns AS cam ON cam.campaign_id = can.campaign_id "
-      "INNER JOIN segments AS s ON s.creative_set_id = can.creative_set_id "
-      "LEFT JOIN embeddings AS e ON e.creative_set_id = can.creative_set_id "
-      "INNER JOIN creative_ads AS ca ON ca.creative_instance_id = "
-      "can.creative_instance_id INNER JOIN geo_targets AS gt ON gt.campaign_id "
-      "= can.campaign_id INNER JOIN dayparts AS dp ON dp.campaign_id = "
-      "can.campaign_id WHERE s.segment IN $2 AND $3 BETWEEN "
-      "cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), BuildBindingParameterPlaceholder(segments.size()),
-       TimeAsTimestampString(base::Time::Now())},
-      nullptr);
-
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::READ;
-  command->command = query;
-
-  int index = 0;
-  for (const auto& segment : segments) {
-    BindString(command.get(), index, base::ToLowerASCII(segment));
-    index++;
-  }
-
-  command->record_bindings = {
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_instance_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
-      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // split_test_group
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // embedding
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // title
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // body
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->start_minute
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE  // dayparts->end_minute
-  };
-
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  transaction->commands.push_back(std::move(command));
-
-  AdsClientHelper::GetInstance()->RunDBTransaction(
-      std::move(transaction),
-      base::BindOnce(&OnGetForSegments, segments, std::move(callback)));
+  MaybeLoadSnapshot(GetTableName(), base::BindOnce(&OnGetForSegments, segments,
+                                                  std::move(callback)));
 }
 
 void CreativeNotificationAds::GetAll(
     GetCreativeNotificationAdsCallback callback) const {
-  const std::string query = base::ReplaceStringPlaceholders(
-      "SELECT can.creative_instance_id, can.creative_set_id, can.campaign_id, "
-      "cam.start_at_timestamp, cam.end_at_timestamp, cam.daily_cap, "
-      "cam.advertiser_id, cam.priority, ca.conversion, ca.per_day, "
-      "ca.per_week, ca.per_month, ca.total_max, ca.value, ca.split_test_group, "
-      "s.segment, e.embedding, gt.geo_target, ca.target_url, can.title, "
-      "can.body, cam.ptr, dp.dow, dp.start_minute, dp.end_minute FROM $1 AS "
-      "can INNER JOIN campaigns AS cam ON cam.campaign_id = can.campaign_id "
-      "INNER JOIN segments AS s ON s.creative_set_id = can.creative_set_id "
-      "LEFT JOIN embeddings AS e ON e.creative_set_id = can.creative_set_id "
-      "INNER JOIN creative_ads AS ca ON ca.creative_instance_id = "
-      "can.creative_instance_id INNER JOIN geo_targets AS gt ON gt.campaign_id "
-      "= can.campaign_id INNER JOIN dayparts AS dp ON dp.campaign_id = "
-      "can.campaign_id WHERE $2 BETWEEN cam.start_at_timestamp AND "
-      "cam.end_at_timestamp",
-      {GetTableName(), TimeAsTimestampString(base::Time::Now())}, nullptr);
-
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::READ;
-  command->command = query;
-
-  command->record_bindings = {
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_instance_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
-      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // split_test_group
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // embedding
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // title
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // body
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->start_minute
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE  // dayparts->end_minute
-  };
-
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  transaction->commands.push_back(std::move(command));
-
-  AdsClientHelper::GetInstance()->RunDBTransaction(
-      std::move(transaction), base::BindOnce(&OnGetAll, std::move(callback)));
+  MaybeLoadSnapshot(GetTableName(),
+                    base::BindOnce(&OnGetAll, std::move(callback)));
 }
 
 std::string CreativeNotificationAds::GetTableName() const {
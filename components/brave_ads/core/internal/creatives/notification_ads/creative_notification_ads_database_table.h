@@ -50,6 +50,8 @@ class CreativeNotificationAds final : public TableInterface {
 
   void Delete(ResultCallback callback) const;
 
+  // Creative ads are served from |CreativeNotificationAdsSnapshot|, which is
+  // read from the database once and kept in sync by |Save| and |Delete|.
   void GetForSegments(const SegmentList& segments,
                       GetCreativeNotificationAdsCallback callback) const;
 
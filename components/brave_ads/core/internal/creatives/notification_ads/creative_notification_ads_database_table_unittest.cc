@@ -281,6 +281,40 @@ TEST_F(BraveAdsCreativeNotificationAdsDatabaseTableTest,
           std::move(expected_creative_ads)));
 }
 
+TEST_F(BraveAdsCreativeNotificationAdsDatabaseTableTest,
+       GetCreativeNotificationAdsForMixedCaseSegmentSavedAfterLoad) {
+  // Arrange
+  database_table_.GetAll(
+      base::BindOnce([](const bool success, const SegmentList& /*segments*/,
+                        const CreativeNotificationAdList& creative_ads) {
+        ASSERT_TRUE(success);
+        EXPECT_TRUE(creative_ads.empty());
+      }));
+
+  CreativeNotificationAdInfo creative_ad =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad.segment = "Food & Drink";
+
+  // Act
+  SaveCreativeAds({creative_ad});
+
+  // Assert
+  CreativeNotificationAdInfo expected_creative_ad = creative_ad;
+  expected_creative_ad.segment = "food & drink";
+
+  database_table_.GetForSegments(
+      /*segments*/ {"food & drink"},
+      base::BindOnce(
+          [](const CreativeNotificationAdInfo& expected_creative_ad,
+             const bool success, const SegmentList& /*segments*/,
+             const CreativeNotificationAdList& creative_ads) {
+            EXPECT_TRUE(success);
+            EXPECT_EQ(CreativeNotificationAdList{expected_creative_ad},
+                      creative_ads);
+          },
+          std::move(expected_creative_ad)));
+}
+
 TEST_F(BraveAdsCreativeNotificationAdsDatabaseTableTest, TableName) {
   // Arrange
 
@@ -0,0 +1,219 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
+
+#include <iterator>
+#include <utility>
+
+#include "base/check.h"
+#include "base/containers/contains.h"
+#include "base/strings/string_util.h"
+#include "brave/components/brave_ads/core/internal/global_state/global_state.h"
+
+namespace brave_ads {
+
+namespace {
+
+bool IsActive(const CreativeNotificationAdInfo& creative_ad,
+              const base::Time time) {
+  return creative_ad.start_at <= time && time <= creative_ad.end_at;
+}
+
+void MaybeAddCreativeAd(
+    const CreativeNotificationAdInfo& creative_ad,
+    const base::Time time,
+    std::map<std::string, const CreativeNotificationAdInfo*>* creative_ads) {
+  DCHECK(creative_ads);
+
+  if (!IsActive(creative_ad, time)) {
+    return;
+  }
+
+  // A creative ad matching several segments is only returned once.
+  creative_ads->insert({creative_ad.creative_instance_id, &creative_ad});
+}
+
+CreativeNotificationAdList ToCreativeAdList(
+    const std::map<std::string, const CreativeNotificationAdInfo*>&
+        creative_ads) {
+  CreativeNotificationAdList list;
+  list.reserve(creative_ads.size());
+  for (const auto& [creative_instance_id, creative_ad] : creative_ads) {
+    list.push_back(*creative_ad);
+  }
+
+  return list;
+}
+
+}  // namespace
+
+CreativeNotificationAdsSnapshot::CampaignTargetingInfo::
+    CampaignTargetingInfo() = default;
+
+CreativeNotificationAdsSnapshot::CampaignTargetingInfo::CampaignTargetingInfo(
+    const CampaignTargetingInfo&) = default;
+
+CreativeNotificationAdsSnapshot::CampaignTargetingInfo&
+CreativeNotificationAdsSnapshot::CampaignTargetingInfo::operator=(
+    const CampaignTargetingInfo&) = default;
+
+CreativeNotificationAdsSnapshot::CampaignTargetingInfo::
+    ~CampaignTargetingInfo() = default;
+
+CreativeNotificationAdsSnapshot::CreativeNotificationAdsSnapshot() = default;
+
+CreativeNotificationAdsSnapshot::~CreativeNotificationAdsSnapshot() = default;
+
+// static
+CreativeNotificationAdsSnapshot*
+CreativeNotificationAdsSnapshot::GetInstance() {
+  auto* snapshot =
+      GlobalState::GetInstance()->GetCreativeNotificationAdsSnapshot();
+  DCHECK(snapshot);
+  return snapshot;
+}
+
+bool CreativeNotificationAdsSnapshot::AddLoadCallback(LoadCallback callback) {
+  DCHECK(!is_loaded_);
+
+  load_callbacks_.push_back(std::move(callback));
+  return load_callbacks_.size() == 1;
+}
+
+void CreativeNotificationAdsSnapshot::DidLoad(
+    const bool success,
+    const CreativeNotificationAdList& creative_ads) {
+  if (success) {
+    creative_ads_.clear();
+    segments_.clear();
+    campaigns_.clear();
+    Add(creative_ads);
+    BuildIndex();
+
+    is_loaded_ = true;
+  }
+
+  std::vector<LoadCallback> callbacks = std::move(load_callbacks_);
+  load_callbacks_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(success);
+  }
+}
+
+void CreativeNotificationAdsSnapshot::Update(
+    const CreativeNotificationAdList& creative_ads) {
+  if (!is_loaded_) {
+    return;
+  }
+
+  Add(creative_ads);
+  BuildIndex();
+}
+
+void CreativeNotificationAdsSnapshot::Clear() {
+  if (!is_loaded_) {
+    return;
+  }
+
+  creative_ads_.clear();
+  segments_.clear();
+  campaigns_.clear();
+  creative_ads_by_segment_.clear();
+}
+
+CreativeNotificationAdList CreativeNotificationAdsSnapshot::GetForSegments(
+    const SegmentList& segments,
+    const base::Time time) const {
+  DCHECK(is_loaded_);
+
+  std::map<std::string, const CreativeNotificationAdInfo*> creative_ads;
+
+  for (const auto& segment : segments) {
+    const auto iter =
+        creative_ads_by_segment_.find(base::ToLowerASCII(segment));
+    if (iter == creative_ads_by_segment_.cend()) {
+      continue;
+    }
+
+    for (const auto& creative_ad : iter->second) {
+      MaybeAddCreativeAd(creative_ad, time, &creative_ads);
+    }
+  }
+
+  return ToCreativeAdList(creative_ads);
+}
+
+CreativeNotificationAdList CreativeNotificationAdsSnapshot::GetAll(
+    const base::Time time) const {
+  DCHECK(is_loaded_);
+
+  std::map<std::string, const CreativeNotificationAdInfo*> creative_ads;
+
+  for (const auto& [segment, segment_creative_ads] : creative_ads_by_segment_) {
+    for (const auto& creative_ad : segment_creative_ads) {
+      MaybeAddCreativeAd(creative_ad, time, &creative_ads);
+    }
+  }
+
+  return ToCreativeAdList(creative_ads);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void CreativeNotificationAdsSnapshot::Add(
+    const CreativeNotificationAdList& creative_ads) {
+  for (const auto& creative_ad : creative_ads) {
+    creative_ads_[creative_ad.creative_instance_id] = creative_ad;
+
+    segments_[creative_ad.creative_set_id].insert(
+        base::ToLowerASCII(creative_ad.segment));
+
+    CampaignTargetingInfo& campaign = campaigns_[creative_ad.campaign_id];
+    campaign.geo_targets.insert(creative_ad.geo_targets.cbegin(),
+                                creative_ad.geo_targets.cend());
+    for (const auto& daypart : creative_ad.dayparts) {
+      if (!base::Contains(campaign.dayparts, daypart)) {
+        campaign.dayparts.push_back(daypart);
+      }
+    }
+  }
+}
+
+void CreativeNotificationAdsSnapshot::BuildIndex() {
+  std::map<std::string, CreativeNotificationAdList> creative_ads_by_segment;
+
+  for (const auto& [creative_instance_id, creative_ad] : creative_ads_) {
+    const auto segments_iter = segments_.find(creative_ad.creative_set_id);
+    const auto campaign_iter = campaigns_.find(creative_ad.campaign_id);
+    if (segments_iter == segments_.cend() ||
+        campaign_iter == campaigns_.cend()) {
+      continue;
+    }
+
+    // Creative ads must be geo targeted and have at least one daypart to be
+    // served.
+    const CampaignTargetingInfo& campaign = campaign_iter->second;
+    if (campaign.geo_targets.empty() || campaign.dayparts.empty()) {
+      continue;
+    }
+
+    for (const auto& segment : segments_iter->second) {
+      CreativeNotificationAdInfo segment_creative_ad = creative_ad;
+      segment_creative_ad.segment = segment;
+      segment_creative_ad.geo_targets = campaign.geo_targets;
+      segment_creative_ad.dayparts = campaign.dayparts;
+      creative_ads_by_segment[segment].push_back(
+          std::move(segment_creative_ad));
+    }
+  }
+
+  creative_ads_by_segment_ =
+      base::flat_map<std::string, CreativeNotificationAdList>(
+          std::make_move_iterator(creative_ads_by_segment.begin()),
+          std::make_move_iterator(creative_ads_by_segment.end()));
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,109 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NOTIFICATION_ADS_CREATIVE_NOTIFICATION_ADS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NOTIFICATION_ADS_CREATIVE_NOTIFICATION_ADS_SNAPSHOT_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
+#include "base/functional/callback.h"
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_daypart_info.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ad_info.h"
+#include "brave/components/brave_ads/core/internal/segments/segment_alias.h"
+
+namespace brave_ads {
+
+// In-memory copy of the creative notification ads, denormalized and indexed by
+// segment when the catalog is saved, so serving an ad doesn't have to join the
+// creative tables in the database for every ad opportunity. The snapshot is
+// loaded from the database once and then kept in sync by the creative
+// notification ads database table.
+class CreativeNotificationAdsSnapshot final {
+ public:
+  using LoadCallback = base::OnceCallback<void(bool success)>;
+
+  CreativeNotificationAdsSnapshot();
+
+  CreativeNotificationAdsSnapshot(const CreativeNotificationAdsSnapshot&) =
+      delete;
+  CreativeNotificationAdsSnapshot& operator=(
+      const CreativeNotificationAdsSnapshot&) = delete;
+
+  CreativeNotificationAdsSnapshot(CreativeNotificationAdsSnapshot&&) noexcept =
+      delete;
+  CreativeNotificationAdsSnapshot& operator=(
+      CreativeNotificationAdsSnapshot&&) noexcept = delete;
+
+  ~CreativeNotificationAdsSnapshot();
+
+  static CreativeNotificationAdsSnapshot* GetInstance();
+
+  bool IsLoaded() const { return is_loaded_; }
+
+  // Queues |callback| until the snapshot has been loaded. Returns true for the
+  // first queued callback, in which case the caller should read the creative
+  // ads from the database and call |DidLoad|.
+  bool AddLoadCallback(LoadCallback callback);
+
+  // Replaces the snapshot with |creative_ads|, which may contain a creative ad
+  // once per segment, geo target and daypart, and runs the queued callbacks.
+  void DidLoad(bool success, const CreativeNotificationAdList& creative_ads);
+
+  // Mirrors saving |creative_ads| to the database. Ignored until the snapshot
+  // has been loaded, as loading reads them from the database.
+  void Update(const CreativeNotificationAdList& creative_ads);
+
+  // Mirrors deleting the creative notification ads from the database.
+  void Clear();
+
+  // Returns creative ads which are active at |time| and match any of the
+  // |segments|, ordered by creative instance id.
+  CreativeNotificationAdList GetForSegments(const SegmentList& segments,
+                                            base::Time time) const;
+
+  // Returns all creative ads which are active at |time|, ordered by creative
+  // instance id.
+  CreativeNotificationAdList GetAll(base::Time time) const;
+
+ private:
+  struct CampaignTargetingInfo {
+    CampaignTargetingInfo();
+
+    CampaignTargetingInfo(const CampaignTargetingInfo&);
+    CampaignTargetingInfo& operator=(const CampaignTargetingInfo&);
+
+    ~CampaignTargetingInfo();
+
+    base::flat_set<std::string> geo_targets;
+    CreativeDaypartList dayparts;
+  };
+
+  void Add(const CreativeNotificationAdList& creative_ads);
+  void BuildIndex();
+
+  bool is_loaded_ = false;
+  std::vector<LoadCallback> load_callbacks_;
+
+  // Keyed the same way as the corresponding database tables, so updates
+  // replace rows the way the database does.
+  std::map</*creative_instance_id*/ std::string, CreativeNotificationAdInfo>
+      creative_ads_;
+  std::map</*creative_set_id*/ std::string, base::flat_set<std::string>>
+      segments_;
+  std::map</*campaign_id*/ std::string, CampaignTargetingInfo> campaigns_;
+
+  // Fully populated creative ads for each segment, rebuilt on every update.
+  base::flat_map</*segment*/ std::string, CreativeNotificationAdList>
+      creative_ads_by_segment_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NOTIFICATION_ADS_CREATIVE_NOTIFICATION_ADS_SNAPSHOT_H_
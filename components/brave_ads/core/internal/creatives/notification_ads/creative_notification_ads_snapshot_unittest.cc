@@ -0,0 +1,242 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
+
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "base/strings/string_number_conversions.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ad_unittest_util.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+class BraveAdsCreativeNotificationAdsSnapshotTest : public UnitTestBase {
+ protected:
+  void Load(const CreativeNotificationAdList& creative_ads) {
+    ASSERT_TRUE(snapshot_.AddLoadCallback(base::BindOnce(
+        [](const bool success) { EXPECT_TRUE(success); })));
+    snapshot_.DidLoad(/*success*/ true, creative_ads);
+  }
+
+  CreativeNotificationAdsSnapshot snapshot_;
+};
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, CoalesceLoads) {
+  // Arrange
+  int load_count = 0;
+  const auto on_load = [](int* load_count, const bool success) {
+    EXPECT_TRUE(success);
+    (*load_count)++;
+  };
+
+  // Act
+  EXPECT_TRUE(
+      snapshot_.AddLoadCallback(base::BindOnce(on_load, &load_count)));
+  EXPECT_FALSE(
+      snapshot_.AddLoadCallback(base::BindOnce(on_load, &load_count)));
+  snapshot_.DidLoad(/*success*/ true, /*creative_ads*/ {});
+
+  // Assert
+  EXPECT_TRUE(snapshot_.IsLoaded());
+  EXPECT_EQ(2, load_count);
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, RetryFailedLoad) {
+  // Arrange
+  ASSERT_TRUE(snapshot_.AddLoadCallback(
+      base::BindOnce([](const bool success) { EXPECT_FALSE(success); })));
+
+  // Act
+  snapshot_.DidLoad(/*success*/ false, /*creative_ads*/ {});
+
+  // Assert
+  EXPECT_FALSE(snapshot_.IsLoaded());
+  EXPECT_TRUE(snapshot_.AddLoadCallback(base::DoNothing()));
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest,
+       GroupGeoTargetsAndDaypartsForCampaign) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+
+  CreativeNotificationAdInfo creative_ad_geo_target = creative_ad;
+  creative_ad_geo_target.geo_targets = {"GB"};
+
+  CreativeNotificationAdInfo creative_ad_daypart = creative_ad;
+  creative_ad_daypart.dayparts = {
+      {.dow = "06", .start_minute = 0, .end_minute = 719}};
+
+  // Act
+  Load({creative_ad, creative_ad_geo_target, creative_ad_daypart});
+
+  // Assert
+  CreativeNotificationAdInfo expected_creative_ad = creative_ad;
+  expected_creative_ad.geo_targets = {"GB", "US"};
+  expected_creative_ad.dayparts.push_back(creative_ad_daypart.dayparts[0]);
+
+  EXPECT_EQ(CreativeNotificationAdList{expected_creative_ad},
+            snapshot_.GetForSegments({creative_ad.segment}, Now()));
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, GetForSegments) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad_1 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_1.segment = "food & drink";
+
+  CreativeNotificationAdInfo creative_ad_2 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_2.segment = "technology & computing";
+
+  // Act
+  Load({creative_ad_1, creative_ad_2});
+
+  // Assert
+  EXPECT_EQ(CreativeNotificationAdList{creative_ad_1},
+            snapshot_.GetForSegments({"FoOd & DrInK"}, Now()));
+  EXPECT_TRUE(snapshot_.GetForSegments({"automobiles"}, Now()).empty());
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest,
+       GetCreativeAdMatchingMultipleSegmentsOnce) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad_1 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_1.segment = "technology & computing-software";
+
+  CreativeNotificationAdInfo creative_ad_2 = creative_ad_1;
+  creative_ad_2.segment = "technology & computing";
+
+  Load({creative_ad_1, creative_ad_2});
+
+  // Act
+  const CreativeNotificationAdList creative_ads = snapshot_.GetForSegments(
+      {creative_ad_1.segment, creative_ad_2.segment}, Now());
+
+  // Assert
+  EXPECT_EQ(CreativeNotificationAdList{creative_ad_1}, creative_ads);
+  EXPECT_EQ(1U, snapshot_.GetAll(Now()).size());
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, DoNotGetInactiveAds) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad_1 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_1.start_at = DistantPast();
+  creative_ad_1.end_at = Now();
+
+  CreativeNotificationAdInfo creative_ad_2 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_2.start_at = Now() + base::Hours(2);
+  creative_ad_2.end_at = DistantFuture();
+
+  Load({creative_ad_1, creative_ad_2});
+
+  // Act
+  AdvanceClockBy(base::Hours(1));
+
+  // Assert
+  EXPECT_TRUE(snapshot_.GetAll(Now()).empty());
+
+  AdvanceClockBy(base::Hours(1));
+  EXPECT_EQ(CreativeNotificationAdList{creative_ad_2},
+            snapshot_.GetAll(Now()));
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, Update) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  Load({creative_ad});
+
+  // Act
+  creative_ad.title = "Updated Test Ad Title";
+  snapshot_.Update({creative_ad});
+
+  // Assert
+  EXPECT_EQ(CreativeNotificationAdList{creative_ad}, snapshot_.GetAll(Now()));
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest,
+       UpdateWithMixedCaseSegment) {
+  // Arrange
+  Load({});
+
+  CreativeNotificationAdInfo creative_ad =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad.segment = "Food & Drink";
+
+  // Act
+  snapshot_.Update({creative_ad});
+
+  // Assert
+  CreativeNotificationAdInfo expected_creative_ad = creative_ad;
+  expected_creative_ad.segment = "food & drink";
+
+  EXPECT_EQ(CreativeNotificationAdList{expected_creative_ad},
+            snapshot_.GetForSegments({"food & drink"}, Now()));
+  EXPECT_EQ(CreativeNotificationAdList{expected_creative_ad},
+            snapshot_.GetForSegments({"FoOd & DrInK"}, Now()));
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, IgnoreUpdateUntilLoaded) {
+  // Arrange
+  snapshot_.Update(BuildCreativeNotificationAds(/*count*/ 1));
+
+  // Act
+  Load({});
+
+  // Assert
+  EXPECT_TRUE(snapshot_.GetAll(Now()).empty());
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, Clear) {
+  // Arrange
+  Load(BuildCreativeNotificationAds(/*count*/ 2));
+
+  // Act
+  snapshot_.Clear();
+
+  // Assert
+  EXPECT_TRUE(snapshot_.IsLoaded());
+  EXPECT_TRUE(snapshot_.GetAll(Now()).empty());
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest,
+       GetForSegmentsFromLargeCatalog) {
+  // Arrange
+  constexpr int kSegmentCount = 100;
+  constexpr int kCreativeAdsPerSegment = 100;
+
+  CreativeNotificationAdList creative_ads;
+  for (int i = 0; i < kSegmentCount * kCreativeAdsPerSegment; i++) {
+    CreativeNotificationAdInfo creative_ad =
+        BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+    creative_ad.segment = "segment-" + base::NumberToString(i % kSegmentCount);
+    creative_ads.push_back(creative_ad);
+  }
+
+  Load(creative_ads);
+
+  // Act
+  const CreativeNotificationAdList segment_creative_ads =
+      snapshot_.GetForSegments({"segment-1", "segment-2", "segment-3"}, Now());
+
+  // Assert
+  EXPECT_EQ(static_cast<size_t>(3 * kCreativeAdsPerSegment),
+            segment_creative_ads.size());
+  for (const auto& creative_ad : segment_creative_ads) {
+    EXPECT_TRUE(creative_ad.segment == "segment-1" ||
+                creative_ad.segment == "segment-2" ||
+                creative_ad.segment == "segment-3");
+  }
+}
+
+}  // namespace brave_ads
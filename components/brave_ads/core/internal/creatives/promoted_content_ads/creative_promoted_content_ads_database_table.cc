@@ -21,7 +21,6 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_table_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
-#include "brave/components/brave_ads/core/internal/common/time/time_formatting_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/campaigns_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ads_database_table.h"
@@ -371,10 +370,9 @@ void CreativePromotedContentAds::GetForSegments(
       "creative_ads AS ca ON ca.creative_instance_id = "
       "cpca.creative_instance_id INNER JOIN geo_targets AS gt ON "
       "gt.campaign_id = cpca.campaign_id INNER JOIN dayparts AS dp ON "
-      "dp.campaign_id = cpca.campaign_id WHERE s.segment IN $2 AND $3 BETWEEN "
+      "dp.campaign_id = cpca.campaign_id WHERE s.segment IN $2 AND ? BETWEEN "
       "cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), BuildBindingParameterPlaceholder(segments.size()),
-       TimeAsTimestampString(base::Time::Now())},
+      {GetTableName(), BuildBindingParameterPlaceholder(segments.size())},
       nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
@@ -387,6 +385,8 @@ void CreativePromotedContentAds::GetForSegments(
     index++;
   }
 
+  BindDouble(command.get(), index, base::Time::Now().ToDoubleT());
+
   command->record_bindings = {
       mojom::DBCommandInfo::RecordBindingType::
           STRING_TYPE,  // creative_instance_id
@@ -437,14 +437,16 @@ void CreativePromotedContentAds::GetAll(
       "creative_ads AS ca ON ca.creative_instance_id = "
       "cpca.creative_instance_id INNER JOIN geo_targets AS gt ON "
       "gt.campaign_id = cpca.campaign_id INNER JOIN dayparts AS dp ON "
-      "dp.campaign_id = cpca.campaign_id WHERE $2 BETWEEN "
+      "dp.campaign_id = cpca.campaign_id WHERE ? BETWEEN "
       "cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), TimeAsTimestampString(base::Time::Now())}, nullptr);
+      {GetTableName()}, nullptr);
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
   command->type = mojom::DBCommandInfo::Type::READ;
   command->command = query;
 
+  BindDouble(command.get(), 0, base::Time::Now().ToDoubleT());
+
   command->record_bindings = {
       mojom::DBCommandInfo::RecordBindingType::
           STRING_TYPE,  // creative_instance_id
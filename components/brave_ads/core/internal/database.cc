@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_ads/core/database.h"
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -19,7 +20,14 @@
 
 namespace brave_ads {
 
-Database::Database(base::FilePath path) : db_path_(std::move(path)) {
+namespace {
+
+constexpr size_t kMaximumCachedStatements = 64;
+
+}  // namespace
+
+Database::Database(base::FilePath path)
+    : db_path_(std::move(path)), statements_(kMaximumCachedStatements) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 
   db_.set_error_callback(base::BindRepeating(&Database::OnErrorCallback,
@@ -156,18 +164,19 @@ mojom::DBCommandResponseInfo::StatusType Database::Run(
     return mojom::DBCommandResponseInfo::StatusType::INITIALIZATION_ERROR;
   }
 
-  sql::Statement statement;
-  statement.Assign(db_.GetUniqueStatement(command->command.c_str()));
-  if (!statement.is_valid()) {
+  sql::Statement* const statement = GetCachedStatement(command->command);
+  if (!statement) {
     VLOG(0) << "Database store error: Invalid statement";
     return mojom::DBCommandResponseInfo::StatusType::COMMAND_ERROR;
   }
 
   for (const auto& binding : command->bindings) {
-    database::Bind(&statement, *binding);
+    database::Bind(statement, *binding);
   }
 
-  if (!statement.Run()) {
+  const bool success = statement->Run();
+  statement->Reset(/*clear_bound_vars*/ true);
+  if (!success) {
     return mojom::DBCommandResponseInfo::StatusType::COMMAND_ERROR;
   }
 
@@ -184,25 +193,26 @@ mojom::DBCommandResponseInfo::StatusType Database::Read(
     return mojom::DBCommandResponseInfo::StatusType::INITIALIZATION_ERROR;
   }
 
-  sql::Statement statement;
-  statement.Assign(db_.GetUniqueStatement(command->command.c_str()));
-  if (!statement.is_valid()) {
+  sql::Statement* const statement = GetCachedStatement(command->command);
+  if (!statement) {
     VLOG(0) << "Database store error: Invalid statement";
     return mojom::DBCommandResponseInfo::StatusType::COMMAND_ERROR;
   }
 
   for (const auto& binding : command->bindings) {
-    database::Bind(&statement, *binding);
+    database::Bind(statement, *binding);
   }
 
   command_response->result =
       mojom::DBCommandResult::NewRecords(std::vector<mojom::DBRecordInfoPtr>());
 
-  while (statement.Step()) {
+  while (statement->Step()) {
     command_response->result->get_records().push_back(
-        database::CreateRecord(&statement, command->record_bindings));
+        database::CreateRecord(statement, command->record_bindings));
   }
 
+  statement->Reset(/*clear_bound_vars*/ true);
+
   return mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK;
 }
 
@@ -221,6 +231,24 @@ mojom::DBCommandResponseInfo::StatusType Database::Migrate(
   return mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK;
 }
 
+sql::Statement* Database::GetCachedStatement(const std::string& sql) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  const auto iter = statements_.Get(sql);
+  if (iter != statements_.end()) {
+    iter->second->Reset(/*clear_bound_vars*/ true);
+    return iter->second.get();
+  }
+
+  auto statement =
+      std::make_unique<sql::Statement>(db_.GetUniqueStatement(sql.c_str()));
+  if (!statement->is_valid()) {
+    return nullptr;
+  }
+
+  return statements_.Put(sql, std::move(statement))->second.get();
+}
+
 void Database::OnErrorCallback(const int error, sql::Statement* statement) {
   VLOG(0) << "Database error: " << db_.GetDiagnosticInfo(error, statement);
 }
@@ -229,6 +257,7 @@ void Database::OnMemoryPressure(
     base::MemoryPressureListener::
         MemoryPressureLevel /*memory_pressure_level*/) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  statements_.Clear();
   db_.TrimMemory();
 }
 
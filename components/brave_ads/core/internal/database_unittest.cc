@@ -0,0 +1,112 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/database.h"
+
+#include <string>
+#include <utility>
+
+#include "base/test/bind.h"
+#include "brave/components/brave_ads/common/interfaces/ads.mojom.h"
+#include "brave/components/brave_ads/core/internal/ads_client_helper.h"
+#include "brave/components/brave_ads/core/internal/common/database/database_bind_util.h"
+#include "brave/components/brave_ads/core/internal/common/database/database_column_util.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+namespace {
+
+mojom::DBCommandResponseInfoPtr RunTransaction(
+    mojom::DBTransactionInfoPtr transaction) {
+  mojom::DBCommandResponseInfoPtr command_response;
+  AdsClientHelper::GetInstance()->RunDBTransaction(
+      std::move(transaction),
+      base::BindLambdaForTesting(
+          [&command_response](mojom::DBCommandResponseInfoPtr response) {
+            command_response = std::move(response);
+          }));
+  return command_response;
+}
+
+void Insert(const std::string& value) {
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::RUN;
+  command->command = "INSERT INTO test (value) VALUES (?);";
+  database::BindString(command.get(), 0, value);
+  transaction->commands.push_back(std::move(command));
+
+  const mojom::DBCommandResponseInfoPtr command_response =
+      RunTransaction(std::move(transaction));
+  ASSERT_TRUE(command_response);
+  ASSERT_EQ(mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK,
+            command_response->status);
+}
+
+mojom::DBCommandResponseInfoPtr Select(const std::string& value) {
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::READ;
+  command->command = "SELECT value FROM test WHERE value = ?;";
+  database::BindString(command.get(), 0, value);
+  command->record_bindings = {
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE};
+  transaction->commands.push_back(std::move(command));
+
+  return RunTransaction(std::move(transaction));
+}
+
+}  // namespace
+
+class BraveAdsDatabaseTest : public UnitTestBase {
+ protected:
+  void SetUp() override {
+    UnitTestBase::SetUp();
+
+    mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+    mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+    command->type = mojom::DBCommandInfo::Type::EXECUTE;
+    command->command = "CREATE TABLE test (value TEXT NOT NULL);";
+    transaction->commands.push_back(std::move(command));
+
+    const mojom::DBCommandResponseInfoPtr command_response =
+        RunTransaction(std::move(transaction));
+    ASSERT_TRUE(command_response);
+    ASSERT_EQ(mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK,
+              command_response->status);
+  }
+};
+
+TEST_F(BraveAdsDatabaseTest, RebindCachedStatements) {
+  // Arrange
+  Insert("foo");
+  Insert("bar");
+
+  // Act
+  const mojom::DBCommandResponseInfoPtr foo_command_response = Select("foo");
+  const mojom::DBCommandResponseInfoPtr bar_command_response = Select("bar");
+  const mojom::DBCommandResponseInfoPtr baz_command_response = Select("baz");
+
+  // Assert
+  ASSERT_TRUE(foo_command_response && foo_command_response->result);
+  ASSERT_EQ(1U, foo_command_response->result->get_records().size());
+  EXPECT_EQ("foo", database::ColumnString(
+                       foo_command_response->result->get_records()[0].get(),
+                       /*index*/ 0));
+
+  ASSERT_TRUE(bar_command_response && bar_command_response->result);
+  ASSERT_EQ(1U, bar_command_response->result->get_records().size());
+  EXPECT_EQ("bar", database::ColumnString(
+                       bar_command_response->result->get_records()[0].get(),
+                       /*index*/ 0));
+
+  ASSERT_TRUE(baz_command_response && baz_command_response->result);
+  EXPECT_TRUE(baz_command_response->result->get_records().empty());
+}
+
+}  // namespace brave_ads
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <utility>
 
@@ -17,6 +18,7 @@
 #include "brave/components/brave_ads/core/ad_info.h"
 #include "brave/components/brave_ads/core/ad_type.h"
 #include "brave/components/brave_ads/core/history_item_info.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_features.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_classification/text_classification_features.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
@@ -32,6 +34,8 @@ namespace {
 
 constexpr uint64_t kMaximumEntriesPerSegmentInPurchaseIntentSignalHistory = 100;
 
+constexpr uint16_t kPurchaseIntentSignalLevel = 1;
+
 FilteredAdvertiserList::iterator FindFilteredAdvertiser(
     const std::string& advertiser_id,
     FilteredAdvertiserList* filtered_advertisers) {
@@ -94,9 +98,13 @@ void OnSaved(const bool success) {
 
 }  // namespace
 
-ClientStateManager::ClientStateManager() : client_(new ClientInfo()) {}
+ClientStateManager::ClientStateManager() : client_(new ClientInfo()) {
+  AdsClientHelper::AddObserver(this);
+}
 
-ClientStateManager::~ClientStateManager() {}
+ClientStateManager::~ClientStateManager() {
+  AdsClientHelper::RemoveObserver(this);
+}
 
 // static
 ClientStateManager* ClientStateManager::GetInstance() {
@@ -172,6 +180,8 @@ void ClientStateManager::AppendToPurchaseIntentSignalHistoryForSegment(
     client_->purchase_intent_signal_history.at(segment).pop_back();
   }
 
+  purchase_intent_scores_.erase(segment);
+
   Save();
 }
 
@@ -182,6 +192,42 @@ ClientStateManager::GetPurchaseIntentSignalHistory() const {
   return client_->purchase_intent_signal_history;
 }
 
+uint16_t ClientStateManager::GetPurchaseIntentScoreForSegment(
+    const std::string& segment) {
+  DCHECK(is_initialized_);
+
+  const auto iter = client_->purchase_intent_signal_history.find(segment);
+  if (iter == client_->purchase_intent_signal_history.cend()) {
+    return 0;
+  }
+
+  const base::Time now = base::Time::Now();
+
+  PurchaseIntentScoreInfo& score = purchase_intent_scores_[segment];
+  if (!score.calculated_at.is_null() && now >= score.calculated_at &&
+      now <= score.expires_at) {
+    return score.score;
+  }
+
+  const base::TimeDelta time_window =
+      targeting::kPurchaseIntentTimeWindow.Get();
+
+  score = {};
+  score.calculated_at = now;
+  score.expires_at = base::Time::Max();
+  for (const auto& signal : iter->second) {
+    const base::Time signal_decayed_time = signal.created_at + time_window;
+    if (now > signal_decayed_time) {
+      continue;
+    }
+
+    score.score += kPurchaseIntentSignalLevel * signal.weight;
+    score.expires_at = std::min(score.expires_at, signal_decayed_time);
+  }
+
+  return score.score;
+}
+
 AdContentLikeActionType ClientStateManager::ToggleLikeAd(
     const AdContentInfo& ad_content) {
   DCHECK(is_initialized_);
@@ -481,10 +527,12 @@ void ClientStateManager::AppendTextClassificationProbabilitiesToHistory(
 
   const size_t maximum_entries =
       targeting::kTextClassificationPageProbabilitiesHistorySize.Get();
-  if (client_->text_classification_probabilities.size() > maximum_entries) {
-    client_->text_classification_probabilities.resize(maximum_entries);
+  while (client_->text_classification_probabilities.size() > maximum_entries) {
+    client_->text_classification_probabilities.pop_back();
   }
 
+  text_classification_segment_probabilities_.reset();
+
   Save();
 }
 
@@ -495,23 +543,71 @@ ClientStateManager::GetTextClassificationProbabilitiesHistory() {
   return client_->text_classification_probabilities;
 }
 
+const targeting::SegmentProbabilityList&
+ClientStateManager::GetTextClassificationSegmentProbabilities() {
+  DCHECK(is_initialized_);
+
+  if (!text_classification_segment_probabilities_) {
+    // The history is short, so it is summed again from the newest to the
+    // oldest probabilities, the same order the text classification model
+    // always used, rather than kept as running sums.
+    targeting::SegmentProbabilityMap segment_probability_sums;
+    for (const auto& probabilities :
+         client_->text_classification_probabilities) {
+      for (const auto& [segment, page_score] : probabilities) {
+        DCHECK(!segment.empty());
+
+        segment_probability_sums[segment] += page_score;
+      }
+    }
+
+    targeting::SegmentProbabilityList segment_probabilities(
+        segment_probability_sums.size());
+    std::partial_sort_copy(
+        segment_probability_sums.cbegin(), segment_probability_sums.cend(),
+        segment_probabilities.begin(), segment_probabilities.end(),
+        [](const targeting::SegmentProbabilityPair& lhs,
+           const targeting::SegmentProbabilityPair& rhs) {
+          return lhs.second > rhs.second;
+        });
+
+    text_classification_segment_probabilities_ =
+        std::move(segment_probabilities);
+  }
+
+  return *text_classification_segment_probabilities_;
+}
+
 void ClientStateManager::RemoveAllHistory() {
   DCHECK(is_initialized_);
 
   BLOG(1, "Successfully reset client state");
 
   client_ = std::make_unique<ClientInfo>();
+  RebuildAggregates();
 
   Save();
 }
 
+void ClientStateManager::Flush() {
+  if (save_timer_.Stop()) {
+    Write();
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void ClientStateManager::Save() {
-  if (!is_initialized_) {
+  if (!is_initialized_ || save_timer_.IsRunning()) {
     return;
   }
 
+  save_timer_.Start(FROM_HERE, kSaveClientStateAfter,
+                    base::BindOnce(&ClientStateManager::Write,
+                                   weak_factory_.GetWeakPtr()));
+}
+
+void ClientStateManager::Write() {
   BLOG(9, "Saving client state");
 
   const std::string json = client_->ToJson();
@@ -542,6 +638,7 @@ void ClientStateManager::OnLoaded(InitializeCallback callback,
     is_initialized_ = true;
 
     client_ = std::make_unique<ClientInfo>();
+    RebuildAggregates();
     Save();
   } else {
     if (!FromJson(json)) {
@@ -572,8 +669,23 @@ bool ClientStateManager::FromJson(const std::string& json) {
   }
 
   client_ = std::make_unique<ClientInfo>(client);
+  RebuildAggregates();
 
   return true;
 }
 
+void ClientStateManager::RebuildAggregates() {
+  text_classification_segment_probabilities_.reset();
+
+  purchase_intent_scores_.clear();
+}
+
+void ClientStateManager::OnNotifyBrowserDidResignActive() {
+  Flush();
+}
+
+void ClientStateManager::OnNotifyBrowserDidEnterBackground() {
+  Flush();
+}
+
 }  // namespace brave_ads
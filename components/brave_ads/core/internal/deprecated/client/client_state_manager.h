@@ -6,21 +6,26 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_H_
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
 
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/brave_ads/core/ad_content_action_types.h"
 #include "brave/components/brave_ads/core/ads_callback.h"
+#include "brave/components/brave_ads/core/ads_client_notifier_observer.h"
 #include "brave/components/brave_ads/core/category_content_action_types.h"
 #include "brave/components/brave_ads/core/history_item_info.h"
+#include "brave/components/brave_ads/core/internal/common/timer/timer.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_classification/text_classification_alias.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/preferences/filtered_advertiser_info.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/preferences/filtered_category_info.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/preferences/flagged_ad_info.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_signal_history_info.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_ads {
 
@@ -29,7 +34,7 @@ struct AdContentInfo;
 struct AdInfo;
 struct ClientInfo;
 
-class ClientStateManager final {
+class ClientStateManager final : public AdsClientNotifierObserver {
  public:
   ClientStateManager();
 
@@ -39,7 +44,7 @@ class ClientStateManager final {
   ClientStateManager(ClientStateManager&&) noexcept = delete;
   ClientStateManager& operator=(ClientStateManager&&) noexcept = delete;
 
-  ~ClientStateManager();
+  ~ClientStateManager() override;
 
   static ClientStateManager* GetInstance();
 
@@ -57,6 +62,10 @@ class ClientStateManager final {
       const targeting::PurchaseIntentSignalHistoryInfo& history);
   const targeting::PurchaseIntentSignalHistoryMap&
   GetPurchaseIntentSignalHistory() const;
+  // Returns the score of the signals for |segment| which are within the
+  // purchase intent time window. Scores are cached until a signal expires or
+  // a new signal is appended for the segment.
+  uint16_t GetPurchaseIntentScoreForSegment(const std::string& segment);
 
   AdContentLikeActionType ToggleLikeAd(const AdContentInfo& ad_content);
   AdContentLikeActionType ToggleDislikeAd(const AdContentInfo& ad_content);
@@ -91,13 +100,32 @@ class ClientStateManager final {
       const targeting::TextClassificationProbabilityMap& probabilities);
   const targeting::TextClassificationProbabilityList&
   GetTextClassificationProbabilitiesHistory();
+  // Returns segments with their probabilities summed across the history in
+  // descending order of probability. The sums are maintained as probabilities
+  // are appended and evicted, so the history is not walked again.
+  const targeting::SegmentProbabilityList&
+  GetTextClassificationSegmentProbabilities();
 
   void RemoveAllHistory();
 
+  // Writes pending changes immediately instead of after the save delay. Also
+  // called when the browser resigns active or enters the background, as the
+  // browser may be torn down afterwards without shutting down ads.
+  void Flush();
+
   bool is_mutated() const { return is_mutated_; }
 
  private:
+  struct PurchaseIntentScoreInfo {
+    uint16_t score = 0;
+    base::Time calculated_at;
+    // The score is stale after this time, when its oldest signal expires.
+    base::Time expires_at;
+  };
+
+  // Schedules a write, so a burst of mutations is written only once.
   void Save();
+  void Write();
 
   void Load(InitializeCallback callback);
   void OnLoaded(InitializeCallback callback,
@@ -106,12 +134,29 @@ class ClientStateManager final {
 
   bool FromJson(const std::string& json);
 
+  // Must be called whenever |client_| is replaced.
+  void RebuildAggregates();
+
+  // AdsClientNotifierObserver:
+  void OnNotifyBrowserDidResignActive() override;
+  void OnNotifyBrowserDidEnterBackground() override;
+
   std::unique_ptr<ClientInfo> client_;
 
+  // Sorted segment probability sums of the text classification history,
+  // reset whenever the history changes.
+  absl::optional<targeting::SegmentProbabilityList>
+      text_classification_segment_probabilities_;
+
+  std::map</*segment*/ std::string, PurchaseIntentScoreInfo>
+      purchase_intent_scores_;
+
   bool is_mutated_ = false;
 
   bool is_initialized_ = false;
 
+  Timer save_timer_;
+
   base::WeakPtrFactory<ClientStateManager> weak_factory_{this};
 };
 
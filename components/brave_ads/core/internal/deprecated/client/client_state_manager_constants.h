@@ -6,10 +6,15 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_CONSTANTS_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_CONSTANTS_H_
 
+#include "base/time/time.h"
+
 namespace brave_ads {
 
 constexpr char kClientStateFilename[] = "client.json";
 
+// Mutations within this delay are written together.
+constexpr base::TimeDelta kSaveClientStateAfter = base::Seconds(30);
+
 }  // namespace brave_ads
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_CONSTANTS_H_
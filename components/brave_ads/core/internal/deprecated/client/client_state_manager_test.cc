@@ -0,0 +1,41 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
+
+#include "base/functional/bind.h"
+#include "brave/components/brave_ads/core/internal/ads_impl.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager_constants.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+using ::testing::_;
+
+class BraveAdsClientStateManagerIntegrationTest : public UnitTestBase {
+ protected:
+  void SetUp() override {
+    UnitTestBase::SetUpForTesting(/*is_integration_test*/ true);
+
+    // Write any state saved while initializing.
+    ClientStateManager::GetInstance()->Flush();
+  }
+};
+
+TEST_F(BraveAdsClientStateManagerIntegrationTest, FlushOnShutdown) {
+  // Arrange
+  ClientStateManager::GetInstance()->RemoveAllHistory();
+
+  // Act
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  GetAds()->Shutdown(base::BindOnce([](const bool success) {
+    // Assert
+    EXPECT_TRUE(success);
+  }));
+}
+
+}  // namespace brave_ads
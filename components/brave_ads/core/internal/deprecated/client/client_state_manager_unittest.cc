@@ -0,0 +1,286 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
+
+#include <algorithm>
+
+#include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_features.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_classification/text_classification_features.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager_constants.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+using ::testing::_;
+
+class BraveAdsClientStateManagerTest : public UnitTestBase {
+ protected:
+  void SetUp() override {
+    UnitTestBase::SetUp();
+
+    // Write any state saved while initializing.
+    ClientStateManager::GetInstance()->Flush();
+  }
+};
+
+TEST_F(BraveAdsClientStateManagerTest, SaveMutationsTogether) {
+  // Arrange
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+
+  // Act
+  ClientStateManager::GetInstance()->RemoveAllHistory();
+  ClientStateManager::GetInstance()->RemoveAllHistory();
+  FastForwardClockBy(kSaveClientStateAfter - base::Milliseconds(1));
+
+  // Assert
+  ::testing::Mock::VerifyAndClearExpectations(ads_client_mock_.get());
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  FastForwardClockBy(base::Milliseconds(1));
+}
+
+TEST_F(BraveAdsClientStateManagerTest, Flush) {
+  // Arrange
+  ClientStateManager::GetInstance()->RemoveAllHistory();
+
+  // Act
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  ClientStateManager::GetInstance()->Flush();
+
+  // Assert
+  ::testing::Mock::VerifyAndClearExpectations(ads_client_mock_.get());
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+  FastForwardClockBy(kSaveClientStateAfter);
+}
+
+TEST_F(BraveAdsClientStateManagerTest, FlushWhenBrowserResignsActive) {
+  // Arrange
+  ClientStateManager::GetInstance()->RemoveAllHistory();
+
+  // Act
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  NotifyBrowserDidResignActive();
+
+  // Assert
+  ::testing::Mock::VerifyAndClearExpectations(ads_client_mock_.get());
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+  FastForwardClockBy(kSaveClientStateAfter);
+}
+
+TEST_F(BraveAdsClientStateManagerTest, FlushWhenBrowserEntersBackground) {
+  // Arrange
+  ClientStateManager::GetInstance()->RemoveAllHistory();
+
+  // Act
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  NotifyBrowserDidEnterBackground();
+
+  // Assert
+  ::testing::Mock::VerifyAndClearExpectations(ads_client_mock_.get());
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+  FastForwardClockBy(kSaveClientStateAfter);
+}
+
+TEST_F(BraveAdsClientStateManagerTest, DoNotSaveWhenNothingIsPending) {
+  // Arrange
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+
+  // Act
+  NotifyBrowserDidResignActive();
+  NotifyBrowserDidEnterBackground();
+
+  // Assert
+}
+
+TEST_F(BraveAdsClientStateManagerTest,
+       GetTextClassificationSegmentProbabilities) {
+  // Arrange
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"technology & computing", 0.5}, {"sports", 0.1}});
+
+  // Act
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"sports", 0.7}, {"science", 0.2}});
+
+  // Assert
+  const targeting::SegmentProbabilityList expected_segment_probabilities = {
+      {"sports", 0.1 + 0.7},
+      {"technology & computing", 0.5},
+      {"science", 0.2}};
+  EXPECT_EQ(expected_segment_probabilities,
+            ClientStateManager::GetInstance()
+                ->GetTextClassificationSegmentProbabilities());
+}
+
+TEST_F(BraveAdsClientStateManagerTest,
+       EvictTextClassificationSegmentProbabilities) {
+  // Arrange
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"technology & computing", 0.9}});
+
+  // Act
+  const size_t history_size =
+      targeting::kTextClassificationPageProbabilitiesHistorySize.Get();
+  for (size_t i = 0; i < history_size; i++) {
+    ClientStateManager::GetInstance()
+        ->AppendTextClassificationProbabilitiesToHistory({{"sports", 0.1}});
+  }
+
+  // Assert
+  ASSERT_EQ(history_size, ClientStateManager::GetInstance()
+                              ->GetTextClassificationProbabilitiesHistory()
+                              .size());
+  const targeting::SegmentProbabilityList& segment_probabilities =
+      ClientStateManager::GetInstance()
+          ->GetTextClassificationSegmentProbabilities();
+  ASSERT_EQ(1U, segment_probabilities.size());
+  EXPECT_EQ("sports", segment_probabilities.front().first);
+  EXPECT_DOUBLE_EQ(0.1 * history_size, segment_probabilities.front().second);
+}
+
+TEST_F(BraveAdsClientStateManagerTest,
+       SumTextClassificationSegmentProbabilitiesFromHistoryAfterEviction) {
+  // Arrange
+  const size_t history_size =
+      targeting::kTextClassificationPageProbabilitiesHistorySize.Get();
+
+  // Act
+  for (size_t i = 0; i < history_size * 3; i++) {
+    ClientStateManager::GetInstance()
+        ->AppendTextClassificationProbabilitiesToHistory(
+            {{"sports", 0.1 * static_cast<double>(i % 7) + 0.03},
+             {"science", 1.0 / static_cast<double>(i + 3)}});
+  }
+
+  // Assert
+  targeting::SegmentProbabilityMap expected_sums;
+  for (const auto& probabilities :
+       ClientStateManager::GetInstance()
+           ->GetTextClassificationProbabilitiesHistory()) {
+    for (const auto& [segment, page_score] : probabilities) {
+      expected_sums[segment] += page_score;
+    }
+  }
+
+  const targeting::SegmentProbabilityList& segment_probabilities =
+      ClientStateManager::GetInstance()
+          ->GetTextClassificationSegmentProbabilities();
+  ASSERT_EQ(expected_sums.size(), segment_probabilities.size());
+  for (const auto& [segment, probability] : segment_probabilities) {
+    EXPECT_EQ(expected_sums[segment], probability) << segment;
+  }
+}
+
+TEST_F(BraveAdsClientStateManagerTest,
+       SumNearTieTextClassificationSegmentProbabilitiesNewestFirst) {
+  // Arrange
+  const size_t history_size =
+      targeting::kTextClassificationPageProbabilitiesHistorySize.Get();
+  ASSERT_GE(history_size, 3U);
+
+  // Act
+  // (0.3 + 0.2) + 0.1 and (0.1 + 0.2) + 0.3 differ in the last bit, so the
+  // order of "sports" and "science" depends on the summation order.
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"sports", 0.1}, {"science", 0.3}});
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"sports", 0.2}, {"science", 0.2}});
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"sports", 0.3}, {"science", 0.1}});
+
+  // Assert
+  targeting::SegmentProbabilityMap segment_probability_sums;
+  for (const auto& probabilities :
+       ClientStateManager::GetInstance()
+           ->GetTextClassificationProbabilitiesHistory()) {
+    for (const auto& [segment, page_score] : probabilities) {
+      segment_probability_sums[segment] += page_score;
+    }
+  }
+  targeting::SegmentProbabilityList expected_segment_probabilities(
+      segment_probability_sums.size());
+  std::partial_sort_copy(
+      segment_probability_sums.cbegin(), segment_probability_sums.cend(),
+      expected_segment_probabilities.begin(),
+      expected_segment_probabilities.end(),
+      [](const targeting::SegmentProbabilityPair& lhs,
+         const targeting::SegmentProbabilityPair& rhs) {
+        return lhs.second > rhs.second;
+      });
+
+  EXPECT_EQ(expected_segment_probabilities,
+            ClientStateManager::GetInstance()
+                ->GetTextClassificationSegmentProbabilities());
+}
+
+TEST_F(BraveAdsClientStateManagerTest, GetPurchaseIntentScoreForSegment) {
+  // Arrange
+  ClientStateManager::GetInstance()
+      ->AppendToPurchaseIntentSignalHistoryForSegment(
+          "segment", targeting::PurchaseIntentSignalHistoryInfo(Now(), 2));
+
+  AdvanceClockBy(base::Hours(1));
+
+  ClientStateManager::GetInstance()
+      ->AppendToPurchaseIntentSignalHistoryForSegment(
+          "segment", targeting::PurchaseIntentSignalHistoryInfo(Now(), 3));
+
+  // Act
+  const uint16_t score =
+      ClientStateManager::GetInstance()->GetPurchaseIntentScoreForSegment(
+          "segment");
+
+  // Assert
+  EXPECT_EQ(5U, score);
+}
+
+TEST_F(BraveAdsClientStateManagerTest, ExpirePurchaseIntentScoreForSegment) {
+  // Arrange
+  ClientStateManager::GetInstance()
+      ->AppendToPurchaseIntentSignalHistoryForSegment(
+          "segment", targeting::PurchaseIntentSignalHistoryInfo(Now(), 2));
+
+  AdvanceClockBy(base::Hours(1));
+
+  ClientStateManager::GetInstance()
+      ->AppendToPurchaseIntentSignalHistoryForSegment(
+          "segment", targeting::PurchaseIntentSignalHistoryInfo(Now(), 3));
+
+  ASSERT_EQ(5U,
+            ClientStateManager::GetInstance()->GetPurchaseIntentScoreForSegment(
+                "segment"));
+
+  // Act
+  AdvanceClockBy(targeting::kPurchaseIntentTimeWindow.Get() - base::Hours(1) +
+                 base::Milliseconds(1));
+
+  // Assert
+  EXPECT_EQ(3U,
+            ClientStateManager::GetInstance()->GetPurchaseIntentScoreForSegment(
+                "segment"));
+}
+
+TEST_F(BraveAdsClientStateManagerTest,
+       DoNotGetPurchaseIntentScoreForUnknownSegment) {
+  // Arrange
+
+  // Act
+  const uint16_t score =
+      ClientStateManager::GetInstance()->GetPurchaseIntentScoreForSegment(
+          "segment");
+
+  // Assert
+  EXPECT_EQ(0U, score);
+}
+
+}  // namespace brave_ads
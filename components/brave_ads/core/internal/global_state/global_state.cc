@@ -8,6 +8,7 @@
 #include "base/check.h"
 #include "brave/components/brave_ads/core/ads_client.h"
 #include "brave/components/brave_ads/core/internal/browser/browser_manager.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
 #include "brave/components/brave_ads/core/internal/creatives/notification_ads/notification_ad_manager.h"
 #include "brave/components/brave_ads/core/internal/database/database_manager.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
@@ -30,6 +31,8 @@ GlobalState::GlobalState(AdsClient* ads_client)
   browser_manager_ = std::make_unique<BrowserManager>();
   client_state_manager_ = std::make_unique<ClientStateManager>();
   confirmation_state_manager_ = std::make_unique<ConfirmationStateManager>();
+  creative_notification_ads_snapshot_ =
+      std::make_unique<CreativeNotificationAdsSnapshot>();
   predictors_manager_ = std::make_unique<PredictorsManager>();
   database_manager_ = std::make_unique<DatabaseManager>();
   diagnostic_manager_ = std::make_unique<DiagnosticManager>();
@@ -70,6 +73,11 @@ ConfirmationStateManager* GlobalState::GetConfirmationStateManager() {
   return confirmation_state_manager_.get();
 }
 
+CreativeNotificationAdsSnapshot*
+GlobalState::GetCreativeNotificationAdsSnapshot() {
+  return creative_notification_ads_snapshot_.get();
+}
+
 DatabaseManager* GlobalState::GetDatabaseManager() {
   return database_manager_.get();
 }
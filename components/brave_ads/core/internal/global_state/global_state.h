@@ -18,6 +18,7 @@ class GlobalStateHolder;
 class BrowserManager;
 class ClientStateManager;
 class ConfirmationStateManager;
+class CreativeNotificationAdsSnapshot;
 class DatabaseManager;
 class DiagnosticManager;
 class HistoryManager;
@@ -51,6 +52,8 @@ class GlobalState final {
 
   ConfirmationStateManager* GetConfirmationStateManager();
 
+  CreativeNotificationAdsSnapshot* GetCreativeNotificationAdsSnapshot();
+
   DatabaseManager* GetDatabaseManager();
 
   DiagnosticManager* GetDiagnosticManager();
@@ -79,6 +82,8 @@ class GlobalState final {
   std::unique_ptr<BrowserManager> browser_manager_;
   std::unique_ptr<ClientStateManager> client_state_manager_;
   std::unique_ptr<ConfirmationStateManager> confirmation_state_manager_;
+  std::unique_ptr<CreativeNotificationAdsSnapshot>
+      creative_notification_ads_snapshot_;
   std::unique_ptr<DatabaseManager> database_manager_;
   std::unique_ptr<DiagnosticManager> diagnostic_manager_;
   std::unique_ptr<HistoryManager> history_manager_;
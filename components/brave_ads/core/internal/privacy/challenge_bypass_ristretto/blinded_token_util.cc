@@ -6,24 +6,32 @@
 #include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/blinded_token_util.h"
 
 #include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/blinded_token.h"
+#include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/challenge_bypass_ristretto_util.h"
 #include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/token.h"
+#include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/token_util.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_ads::privacy::cbr {
 
 std::vector<BlindedToken> BlindTokens(const std::vector<Token>& tokens) {
-  std::vector<BlindedToken> blinded_tokens;
-  for (Token token : tokens) {
-    if (!token.has_value()) {
-      return {};
-    }
+  const std::vector<challenge_bypass_ristretto::Token> raw_tokens =
+      ToRawTokens(tokens);
+  if (raw_tokens.size() != tokens.size()) {
+    return {};
+  }
 
-    const absl::optional<BlindedToken> blinded_token = token.Blind();
-    if (!blinded_token) {
-      return {};
-    }
+  // Blind all tokens with a single call across the FFI boundary.
+  const absl::optional<std::vector<challenge_bypass_ristretto::BlindedToken>>
+      raw_blinded_tokens = ValueOrLogError(
+          challenge_bypass_ristretto::Token::blind_batch(raw_tokens));
+  if (!raw_blinded_tokens) {
+    return {};
+  }
 
-    blinded_tokens.push_back(*blinded_token);
+  std::vector<BlindedToken> blinded_tokens;
+  blinded_tokens.reserve(raw_blinded_tokens->size());
+  for (const auto& raw_blinded_token : *raw_blinded_tokens) {
+    blinded_tokens.emplace_back(raw_blinded_token);
   }
 
   return blinded_tokens;
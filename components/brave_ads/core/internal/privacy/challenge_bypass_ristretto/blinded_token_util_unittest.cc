@@ -26,6 +26,17 @@ TEST(BraveAdsBlindedTokenUtilTest, BlindTokens) {
   EXPECT_EQ(GetBlindedTokens(), blinded_tokens);
 }
 
+TEST(BraveAdsBlindedTokenUtilTest, DoNotBlindInvalidTokens) {
+  // Arrange
+
+  // Act
+  const std::vector<BlindedToken> blinded_tokens =
+      BlindTokens(GetInvalidTokens());
+
+  // Assert
+  EXPECT_TRUE(blinded_tokens.empty());
+}
+
 TEST(BraveAdsBlindedTokenUtilTToUnblindedTokensest, BlindEmptyTokens) {
   // Arrange
 
@@ -29,6 +29,8 @@ Token::Token()
 
 Token::Token(const std::string& token_base64) : token_(Create(token_base64)) {}
 
+Token::Token(const challenge_bypass_ristretto::Token& token) : token_(token) {}
+
 Token::Token(const Token& other) = default;
 
 Token& Token::operator=(const Token& other) = default;
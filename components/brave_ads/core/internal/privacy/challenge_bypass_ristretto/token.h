@@ -25,6 +25,7 @@ class Token {
  public:
   Token();
   explicit Token(const std::string& token_base64);
+  explicit Token(const challenge_bypass_ristretto::Token& token);
 
   Token(const Token&);
   Token& operator=(const Token&);
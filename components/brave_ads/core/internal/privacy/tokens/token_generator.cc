@@ -5,18 +5,28 @@
 
 #include "brave/components/brave_ads/core/internal/privacy/tokens/token_generator.h"
 
-#include "base/check.h"
+#include "base/check_op.h"
+#include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/challenge_bypass_ristretto_util.h"
 #include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/token.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_ads::privacy {
 
 std::vector<cbr::Token> TokenGenerator::Generate(const int count) const {
-  std::vector<cbr::Token> tokens;
+  DCHECK_GE(count, 0);
+
+  // Generate all tokens with a single call across the FFI boundary.
+  const absl::optional<std::vector<challenge_bypass_ristretto::Token>>
+      raw_tokens = cbr::ValueOrLogError(
+          challenge_bypass_ristretto::Token::random_batch(count));
+  if (!raw_tokens) {
+    return {};
+  }
 
-  for (int i = 0; i < count; i++) {
-    const cbr::Token token;
-    DCHECK(token.has_value());
-    tokens.push_back(token);
+  std::vector<cbr::Token> tokens;
+  tokens.reserve(raw_tokens->size());
+  for (const auto& raw_token : *raw_tokens) {
+    tokens.emplace_back(raw_token);
   }
 
   return tokens;
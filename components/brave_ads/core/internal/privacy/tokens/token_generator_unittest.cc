@@ -24,6 +24,21 @@ TEST(BraveAdsTokenGeneratorTest, Generate) {
   EXPECT_EQ(5U, count);
 }
 
+TEST(BraveAdsTokenGeneratorTest, GenerateBatch) {
+  // Arrange
+  const TokenGenerator token_generator;
+
+  // Act
+  const std::vector<cbr::Token> tokens = token_generator.Generate(500);
+
+  // Assert
+  ASSERT_EQ(500U, tokens.size());
+  for (const auto& token : tokens) {
+    EXPECT_TRUE(token.has_value());
+  }
+  EXPECT_NE(tokens.front(), tokens.back());
+}
+
 TEST(BraveAdsTokenGeneratorTest, GenerateZero) {
   // Arrange
   const TokenGenerator token_generator;
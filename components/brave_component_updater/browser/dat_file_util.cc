@@ -45,6 +45,17 @@ DATFileDataBuffer ReadDATFileData(const base::FilePath& dat_file_path) {
   return buffer;
 }
 
+std::unique_ptr<base::MemoryMappedFile> MapDATFileData(
+    const base::FilePath& dat_file_path) {
+  auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+  if (!mapped_file->Initialize(dat_file_path) || !mapped_file->length()) {
+    LOG(ERROR) << "MapDATFileData: cannot "
+               << "map dat file " << dat_file_path;
+    return nullptr;
+  }
+  return mapped_file;
+}
+
 std::string GetDATFileAsString(const base::FilePath& file_path) {
   std::string contents;
   bool success = base::ReadFileToString(file_path, &contents);
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
 
 namespace brave_component_updater {
 
@@ -21,6 +22,11 @@ std::string GetDATFileAsString(const base::FilePath& file_path);
 
 DATFileDataBuffer ReadDATFileData(const base::FilePath& dat_file_path);
 
+// Maps the file read-only instead of copying it to the heap. Returns nullptr
+// if the file is missing, empty or can't be mapped.
+std::unique_ptr<base::MemoryMappedFile> MapDATFileData(
+    const base::FilePath& dat_file_path);
+
 template <typename T>
 using LoadDATFileDataResult =
     std::pair<std::unique_ptr<T>, brave_component_updater::DATFileDataBuffer>;
@@ -37,6 +43,31 @@ LoadDATFileDataResult<T> LoadDATFileData(const base::FilePath& dat_file_path) {
   return LoadDATFileDataResult<T>(std::move(client), std::move(buffer));
 }
 
+template <typename T>
+using LoadMappedDATFileDataResult =
+    std::pair<std::unique_ptr<T>, std::unique_ptr<base::MemoryMappedFile>>;
+
+// Same as LoadDATFileData, but the deserializer reads straight from the
+// mapping, so there is no heap copy of the file and unused pages can be
+// dropped by the kernel. The mapping is returned for deserializers that keep
+// pointers into the input.
+template <typename T>
+LoadMappedDATFileDataResult<T> LoadMappedDATFileData(
+    const base::FilePath& dat_file_path) {
+  std::unique_ptr<base::MemoryMappedFile> mapped_file =
+      MapDATFileData(dat_file_path);
+  std::unique_ptr<T> client;
+  if (mapped_file) {
+    client = std::make_unique<T>();
+    if (!client->deserialize(
+            reinterpret_cast<const char*>(mapped_file->data()),
+            mapped_file->length()))
+      client.reset();
+  }
+  return LoadMappedDATFileDataResult<T>(std::move(client),
+                                        std::move(mapped_file));
+}
+
 template <typename T>
 LoadDATFileDataResult<T> LoadRawFileData(const base::FilePath& dat_file_path) {
   DATFileDataBuffer buffer = ReadDATFileData(dat_file_path);
@@ -0,0 +1,74 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_component_updater {
+
+namespace {
+
+// Stands in for the engines that deserialize DAT files.
+class FakeEngine {
+ public:
+  bool deserialize(const char* data, size_t size) {
+    serialized_ = std::string(data, size);
+    return true;
+  }
+
+  const std::string& serialized() const { return serialized_; }
+
+ private:
+  std::string serialized_;
+};
+
+}  // namespace
+
+class DATFileUtilTest : public testing::Test {
+ protected:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath GetPath() const {
+    return temp_dir_.GetPath().AppendASCII("rs-ABPFilterParserData.dat");
+  }
+
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(DATFileUtilTest, LoadMappedDATFileData) {
+  const std::string contents = "serialized engine";
+  ASSERT_TRUE(base::WriteFile(GetPath(), contents));
+
+  auto [engine, mapped_file] = LoadMappedDATFileData<FakeEngine>(GetPath());
+
+  ASSERT_TRUE(mapped_file);
+  EXPECT_EQ(contents.size(), mapped_file->length());
+  ASSERT_TRUE(engine);
+  EXPECT_EQ(contents, engine->serialized());
+}
+
+TEST_F(DATFileUtilTest, LoadMappedDATFileDataFromMissingFile) {
+  auto [engine, mapped_file] = LoadMappedDATFileData<FakeEngine>(GetPath());
+
+  EXPECT_FALSE(mapped_file);
+  EXPECT_FALSE(engine);
+}
+
+TEST_F(DATFileUtilTest, LoadMappedDATFileDataFromEmptyFile) {
+  ASSERT_TRUE(base::WriteFile(GetPath(), ""));
+
+  auto [engine, mapped_file] = LoadMappedDATFileData<FakeEngine>(GetPath());
+
+  EXPECT_FALSE(mapped_file);
+  EXPECT_FALSE(engine);
+}
+
+}  // namespace brave_component_updater
@@ -36,6 +36,15 @@ void AsyncDataStore::AddTrainingInstance(
       .Then(std::move(callback));
 }
 
+void AsyncDataStore::AddTrainingInstances(
+    std::vector<std::vector<brave_federated::mojom::CovariateInfoPtr>>
+        training_instances,
+    base::OnceCallback<void(bool)> callback) {
+  data_store_.AsyncCall(&DataStore::AddTrainingInstances)
+      .WithArgs(std::move(training_instances))
+      .Then(std::move(callback));
+}
+
 void AsyncDataStore::LoadTrainingData(
     base::OnceCallback<void(TrainingData)> callback) {
   data_store_.AsyncCall(&DataStore::LoadTrainingData).Then(std::move(callback));
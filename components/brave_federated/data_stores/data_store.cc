@@ -96,11 +96,14 @@ int DataStore::GetNextTrainingInstanceId() {
   return 0;
 }
 
-void DataStore::SaveCovariate(
+bool DataStore::SaveCovariate(
     const brave_federated::mojom::CovariateInfo& covariate,
     int training_instance_id,
     const base::Time created_at) {
-  sql::Statement statement(database_.GetUniqueStatement(
+  // The table name is fixed for the lifetime of |database_|, so the compiled
+  // statement can be reused for every covariate.
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf("INSERT INTO %s (training_instance_id, "
                          "feature_name, feature_type, "
                          "feature_value, created_at) "
@@ -110,7 +113,7 @@ void DataStore::SaveCovariate(
 
   BindCovariateToStatement(covariate, training_instance_id, created_at,
                            &statement);
-  statement.Run();
+  return statement.Run();
 }
 
 bool DataStore::AddTrainingInstance(
@@ -118,11 +121,52 @@ bool DataStore::AddTrainingInstance(
         training_instance) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  const int training_instance_id = GetNextTrainingInstanceId();
+  // Without an explicit transaction every covariate is committed, and synced
+  // to disk, on its own.
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  if (!SaveTrainingInstance(training_instance, GetNextTrainingInstanceId(),
+                            base::Time::Now())) {
+    return false;
+  }
+
+  return transaction.Commit();
+}
+
+bool DataStore::AddTrainingInstances(
+    const std::vector<std::vector<brave_federated::mojom::CovariateInfoPtr>>&
+        training_instances) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  int training_instance_id = GetNextTrainingInstanceId();
   const base::Time created_at = base::Time::Now();
+  for (const auto& training_instance : training_instances) {
+    if (!SaveTrainingInstance(training_instance, training_instance_id++,
+                              created_at)) {
+      return false;
+    }
+  }
 
+  return transaction.Commit();
+}
+
+bool DataStore::SaveTrainingInstance(
+    const std::vector<brave_federated::mojom::CovariateInfoPtr>&
+        training_instance,
+    int training_instance_id,
+    base::Time created_at) {
   for (const auto& covariate : training_instance) {
-    SaveCovariate(*covariate, training_instance_id, created_at);
+    if (!SaveCovariate(*covariate, training_instance_id, created_at)) {
+      return false;
+    }
   }
 
   return true;
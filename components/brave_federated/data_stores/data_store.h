@@ -38,12 +38,17 @@ class DataStore {
   bool InitializeDatabase();
 
   int GetNextTrainingInstanceId();
-  void SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
+  bool SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
                      int training_instance_id,
                      const base::Time created_at);
   bool AddTrainingInstance(
       const std::vector<brave_federated::mojom::CovariateInfoPtr>
           training_instance);
+  // Adds all |training_instances| in a single transaction, so either all or
+  // none of them are stored.
+  bool AddTrainingInstances(
+      const std::vector<std::vector<brave_federated::mojom::CovariateInfoPtr>>&
+          training_instances);
 
   bool DeleteTrainingData();
   TrainingData LoadTrainingData();
@@ -58,6 +63,11 @@ class DataStore {
 
  private:
   bool MaybeCreateTable();
+  bool SaveTrainingInstance(
+      const std::vector<brave_federated::mojom::CovariateInfoPtr>&
+          training_instance,
+      int training_instance_id,
+      base::Time created_at);
 
   SEQUENCE_CHECKER(sequence_checker_);
 };
@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/files/scoped_temp_dir.h"
@@ -155,6 +156,24 @@ TEST_F(DataStoreTest, AddTrainingInstance) {
   EXPECT_EQ(2, TrainingInstanceCount());
 }
 
+TEST_F(DataStoreTest, AddTrainingInstances) {
+  std::vector<std::vector<mojom::CovariateInfoPtr>> training_instances;
+  for (int i = 0; i < 100; ++i) {
+    TrainingData training_data = TrainingDataFromTestInfo();
+    training_instances.push_back(std::move(training_data[i % 2]));
+  }
+
+  EXPECT_TRUE(data_store_->AddTrainingInstances(std::move(training_instances)));
+  EXPECT_EQ(200, RecordCount());
+  EXPECT_EQ(100, TrainingInstanceCount());
+  EXPECT_EQ(101, data_store_->GetNextTrainingInstanceId());
+
+  TrainingData training_data = data_store_->LoadTrainingData();
+  ASSERT_EQ(100U, training_data.size());
+  EXPECT_EQ("cat", training_data[1][0]->value);
+  EXPECT_EQ("42", training_data[2][1]->value);
+}
+
 TEST_F(DataStoreTest, LoadTrainingData) {
   InitializeDataStore();
   EXPECT_EQ(4, RecordCount());
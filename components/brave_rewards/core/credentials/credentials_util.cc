@@ -24,16 +24,14 @@ using challenge_bypass_ristretto::VerificationSignature;
 
 std::vector<Token> GenerateCreds(const int count) {
   DCHECK_GT(count, 0);
-  std::vector<Token> creds;
 
-  for (auto i = 0; i < count; i++) {
-    auto cred = Token::random();
-    if (cred.has_value()) {
-      creds.emplace_back(std::move(cred).value());
-    }
+  // Generate all creds with a single call across the FFI boundary.
+  auto creds = Token::random_batch(count);
+  if (!creds.has_value()) {
+    return {};
   }
 
-  return creds;
+  return std::move(creds).value();
 }
 
 std::string GetCredsJSON(const std::vector<Token>& creds) {
@@ -52,14 +50,12 @@ std::string GetCredsJSON(const std::vector<Token>& creds) {
 std::vector<BlindedToken> GenerateBlindCreds(const std::vector<Token>& creds) {
   DCHECK_NE(creds.size(), 0UL);
 
-  std::vector<BlindedToken> blinded_creds;
-  for (auto cred : creds) {
-    if (auto blinded_cred = cred.blind(); blinded_cred.has_value()) {
-      blinded_creds.push_back(std::move(blinded_cred).value());
-    }
+  auto blinded_creds = Token::blind_batch(creds);
+  if (!blinded_creds.has_value()) {
+    return {};
   }
 
-  return blinded_creds;
+  return std::move(blinded_creds).value();
 }
 
 std::string GetBlindedCredsJSON(
@@ -236,22 +236,45 @@ base::Value::List AdBlockEngine::HiddenClassIdSelectors(
 void AdBlockEngine::Load(bool deserialize,
                          const DATFileDataBuffer& dat_buf,
                          const std::string& resources_json) {
+  std::unique_ptr<adblock::Engine> client =
+      CreateClient(deserialize, dat_buf, resources_json);
+  if (client) {
+    UpdateAdBlockClient(std::move(client));
+  }
+}
+
+// static
+std::unique_ptr<adblock::Engine> AdBlockEngine::CreateClient(
+    bool deserialize,
+    const DATFileDataBuffer& dat_buf,
+    const std::string& resources_json) {
+  std::unique_ptr<adblock::Engine> client;
   if (deserialize) {
-    OnDATLoaded(dat_buf, resources_json);
+    // An empty buffer will not load successfully.
+    if (dat_buf.empty()) {
+      return nullptr;
+    }
+
+    client = std::make_unique<adblock::Engine>();
+    client->deserialize(reinterpret_cast<const char*>(&dat_buf.front()),
+                        dat_buf.size());
   } else {
-    OnListSourceLoaded(dat_buf, resources_json);
+    client = std::make_unique<adblock::Engine>(
+        reinterpret_cast<const char*>(dat_buf.data()), dat_buf.size());
   }
+
+  client->useResources(resources_json);
+  return client;
 }
 
 void AdBlockEngine::UpdateAdBlockClient(
-    std::unique_ptr<adblock::Engine> ad_block_client,
-    const std::string& resources_json) {
+    std::unique_ptr<adblock::Engine> ad_block_client) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  DCHECK(ad_block_client);
   ad_block_client_ = std::move(ad_block_client);
   if (regex_discard_policy_) {
     ad_block_client_->setupDiscardPolicy(*regex_discard_policy_);
   }
-  UseResources(resources_json);
   AddKnownTagsToAdBlockInstance();
   if (test_observer_) {
     test_observer_->OnEngineUpdated();
@@ -266,27 +289,6 @@ void AdBlockEngine::AddKnownTagsToAdBlockInstance() {
   });
 }
 
-void AdBlockEngine::OnListSourceLoaded(const DATFileDataBuffer& filters,
-                                       const std::string& resources_json) {
-  auto engine = std::make_unique<adblock::Engine>(
-      reinterpret_cast<const char*>(filters.data()), filters.size());
-  UpdateAdBlockClient(std::move(engine), resources_json);
-}
-
-void AdBlockEngine::OnDATLoaded(const DATFileDataBuffer& dat_buf,
-                                const std::string& resources_json) {
-  // An empty buffer will not load successfully.
-  if (dat_buf.empty()) {
-    return;
-  }
-
-  auto client = std::make_unique<adblock::Engine>();
-  client->deserialize(reinterpret_cast<const char*>(&dat_buf.front()),
-                      dat_buf.size());
-
-  UpdateAdBlockClient(std::move(client), resources_json);
-}
-
 void AdBlockEngine::AddObserverForTest(AdBlockEngine::TestObserver* observer) {
   test_observer_ = observer;
 }
@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/gtest_prod_util.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_types.h"
 #include "base/sequence_checker.h"
@@ -36,6 +37,8 @@ class PerfPredictorTabHelperTest;
 
 namespace brave_shields {
 
+class AdBlockService;
+
 // Service managing an adblock engine.
 class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
  public:
@@ -78,6 +81,15 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
             const DATFileDataBuffer& dat_buf,
             const std::string& resources_json);
 
+  // Builds a new adblock client from |dat_buf| and |resources_json|. It
+  // doesn't touch any AdBlockEngine state and can run on any sequence, so a
+  // client can be built without blocking requests on the engine's sequence.
+  // Returns nullptr if |dat_buf| can't be loaded.
+  static std::unique_ptr<adblock::Engine> CreateClient(
+      bool deserialize,
+      const DATFileDataBuffer& dat_buf,
+      const std::string& resources_json);
+
   class TestObserver : public base::CheckedObserver {
    public:
     virtual void OnEngineUpdated() = 0;
@@ -88,13 +100,9 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
 
  protected:
   void AddKnownTagsToAdBlockInstance();
-  void UpdateAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client,
-                           const std::string& resources_json);
-  void OnListSourceLoaded(const DATFileDataBuffer& filters,
-                          const std::string& resources_json);
-
-  void OnDATLoaded(const DATFileDataBuffer& dat_buf,
-                   const std::string& resources_json);
+  // Replaces the current client with |ad_block_client|, built by
+  // CreateClient, and applies the tags and discard policy of this engine.
+  void UpdateAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client);
 
   std::unique_ptr<adblock::Engine> ad_block_client_
       GUARDED_BY_CONTEXT(sequence_checker_);
@@ -104,6 +112,11 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
   friend class ::BraveAdBlockTPNetworkDelegateHelperTest;
   friend class ::EphemeralStorage1pDomainBlockBrowserTest;
   friend class ::PerfPredictorTabHelperTest;
+  friend class AdBlockService;
+  FRIEND_TEST_ALL_PREFIXES(AdBlockEngineTest,
+                           UpdateAdBlockClientWithCreatedClient);
+  FRIEND_TEST_ALL_PREFIXES(AdBlockEngineTest,
+                           KeepServingUntilCreatedClientIsApplied);
 
   std::set<std::string> tags_ GUARDED_BY_CONTEXT(sequence_checker_);
   absl::optional<adblock::RegexManagerDiscardPolicy> regex_discard_policy_
@@ -0,0 +1,90 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_engine.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/run_loop.h"
+#include "base/task/task_traits.h"
+#include "base/task/thread_pool.h"
+#include "base/task/thread_pool/thread_pool_instance.h"
+#include "base/test/task_environment.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+namespace {
+
+bool ShouldBlock(AdBlockEngine* engine, const GURL& url) {
+  bool did_match_rule = false;
+  bool did_match_exception = false;
+  bool did_match_important = false;
+  std::string mock_data_url;
+  std::string rewritten_url;
+  engine->ShouldStartRequest(url, blink::mojom::ResourceType::kScript,
+                             "brave.com", false, &did_match_rule,
+                             &did_match_exception, &did_match_important,
+                             &mock_data_url, &rewritten_url);
+  return did_match_rule && !did_match_exception;
+}
+
+}  // namespace
+
+TEST(AdBlockEngineTest, UpdateAdBlockClientWithCreatedClient) {
+  const std::string rules = "||example.com/ad.js\n";
+  const DATFileDataBuffer filters(rules.begin(), rules.end());
+
+  AdBlockEngine engine;
+  EXPECT_FALSE(ShouldBlock(&engine, GURL("https://example.com/ad.js")));
+
+  std::unique_ptr<adblock::Engine> client =
+      AdBlockEngine::CreateClient(/*deserialize=*/false, filters, "[]");
+  ASSERT_TRUE(client);
+  engine.UpdateAdBlockClient(std::move(client));
+
+  EXPECT_TRUE(ShouldBlock(&engine, GURL("https://example.com/ad.js")));
+  EXPECT_FALSE(ShouldBlock(&engine, GURL("https://example.com/app.js")));
+}
+
+TEST(AdBlockEngineTest, KeepServingUntilCreatedClientIsApplied) {
+  base::test::TaskEnvironment task_environment;
+
+  const std::string old_rules = "||example.com/old.js\n";
+  const std::string new_rules = "||example.com/new.js\n";
+
+  AdBlockEngine engine;
+  engine.Load(/*deserialize=*/false,
+              DATFileDataBuffer(old_rules.begin(), old_rules.end()), "[]");
+  ASSERT_TRUE(ShouldBlock(&engine, GURL("https://example.com/old.js")));
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock()},
+      base::BindOnce(&AdBlockEngine::CreateClient, /*deserialize=*/false,
+                     DATFileDataBuffer(new_rules.begin(), new_rules.end()),
+                     std::string("[]")),
+      base::BindOnce(&AdBlockEngine::UpdateAdBlockClient, engine.AsWeakPtr()));
+
+  // The new client is built, but its reply hasn't run on this sequence yet.
+  base::ThreadPoolInstance::Get()->FlushForTesting();
+  EXPECT_TRUE(ShouldBlock(&engine, GURL("https://example.com/old.js")));
+  EXPECT_FALSE(ShouldBlock(&engine, GURL("https://example.com/new.js")));
+
+  base::RunLoop().RunUntilIdle();
+  EXPECT_FALSE(ShouldBlock(&engine, GURL("https://example.com/old.js")));
+  EXPECT_TRUE(ShouldBlock(&engine, GURL("https://example.com/new.js")));
+}
+
+TEST(AdBlockEngineTest, DoNotCreateClientFromEmptyDAT) {
+  EXPECT_FALSE(AdBlockEngine::CreateClient(/*deserialize=*/true,
+                                           DATFileDataBuffer(), "[]"));
+}
+
+}  // namespace brave_shields
@@ -12,6 +12,7 @@
 #include "base/files/file_path.h"
 #include "base/functional/bind.h"
 #include "base/logging.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/thread_restrictions.h"
 #include "brave/components/brave_shields/browser/ad_block_component_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_provider.h"
@@ -59,7 +60,10 @@ AdBlockService::SourceProviderObserver::SourceProviderObserver(
     : adblock_engine_(adblock_engine),
       filters_provider_(filters_provider),
       resource_provider_(resource_provider),
-      task_runner_(task_runner) {
+      task_runner_(task_runner),
+      build_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
   filters_provider_->AddObserver(this);
   filters_provider_->LoadDAT(
       base::BindOnce(&AdBlockService::SourceProviderObserver::OnDATLoaded,
@@ -90,22 +94,52 @@ void AdBlockService::SourceProviderObserver::OnDATLoaded(
 
 void AdBlockService::SourceProviderObserver::OnResourcesLoaded(
     const std::string& resources_json) {
+  // Both branches go through |build_task_runner_|, so updates reach the
+  // engine in the order they were loaded.
   if (dat_buf_.empty()) {
-    task_runner_->PostTask(
+    build_task_runner_->PostTask(
         FROM_HERE,
-        base::BindOnce(&AdBlockEngine::UseResources,
-                       adblock_engine_->AsWeakPtr(), resources_json));
+        base::BindOnce(
+            [](scoped_refptr<base::SequencedTaskRunner> task_runner,
+               base::WeakPtr<AdBlockEngine> engine,
+               const std::string& resources_json) {
+              task_runner->PostTask(
+                  FROM_HERE, base::BindOnce(&AdBlockEngine::UseResources,
+                                            engine, resources_json));
+            },
+            task_runner_, adblock_engine_->AsWeakPtr(), resources_json));
   } else {
-    auto engine_load_callback = base::BindOnce(
-        [](base::WeakPtr<AdBlockEngine> engine, bool deserialize,
-           DATFileDataBuffer dat_buf, const std::string& resources_json) {
-          if (engine) {
-            engine->Load(deserialize, std::move(dat_buf), resources_json);
-          }
-        },
-        adblock_engine_->AsWeakPtr(), deserialize_, std::move(dat_buf_),
-        resources_json);
-    task_runner_->PostTask(FROM_HERE, std::move(engine_load_callback));
+    // The new client is built completely on |build_task_runner_| and only
+    // swapped in on |task_runner_|, which keeps serving requests with the
+    // previous client until then.
+    build_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(
+            [](scoped_refptr<base::SequencedTaskRunner> task_runner,
+               base::WeakPtr<AdBlockEngine> engine, bool deserialize,
+               DATFileDataBuffer dat_buf, const std::string& resources_json) {
+              std::unique_ptr<adblock::Engine> client =
+                  AdBlockEngine::CreateClient(deserialize, dat_buf,
+                                              resources_json);
+              if (!client) {
+                return;
+              }
+              task_runner->PostTask(
+                  FROM_HERE,
+                  base::BindOnce(&AdBlockService::UpdateEngineClient, engine,
+                                 std::move(client)));
+            },
+            task_runner_, adblock_engine_->AsWeakPtr(), deserialize_,
+            std::move(dat_buf_), resources_json));
+  }
+}
+
+// static
+void AdBlockService::UpdateEngineClient(
+    base::WeakPtr<AdBlockEngine> engine,
+    std::unique_ptr<adblock::Engine> client) {
+  if (engine) {
+    engine->UpdateAdBlockClient(std::move(client));
   }
 }
 
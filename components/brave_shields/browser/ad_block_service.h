@@ -35,6 +35,7 @@ class ComponentUpdateService;
 }  // namespace component_updater
 
 namespace adblock {
+class Engine;
 struct RegexManagerDiscardPolicy;
 }
 namespace brave_shields {
@@ -77,6 +78,9 @@ class AdBlockService {
     raw_ptr<AdBlockFiltersProvider> filters_provider_;    // not owned
     raw_ptr<AdBlockResourceProvider> resource_provider_;  // not owned
     scoped_refptr<base::SequencedTaskRunner> task_runner_;
+    // Builds new engine clients off |task_runner_|, so requests aren't
+    // blocked while a list is parsed or deserialized.
+    scoped_refptr<base::SequencedTaskRunner> build_task_runner_;
 
     base::WeakPtrFactory<SourceProviderObserver> weak_factory_{this};
   };
@@ -139,6 +143,11 @@ class AdBlockService {
 
   static std::string g_ad_block_dat_file_version_;
 
+  // Swaps in |client|, built by AdBlockEngine::CreateClient off the engine's
+  // sequence, if |engine| is still alive.
+  static void UpdateEngineClient(base::WeakPtr<AdBlockEngine> engine,
+                                 std::unique_ptr<adblock::Engine> client);
+
   AdBlockResourceProvider* resource_provider();
   AdBlockComponentFiltersProvider* default_filters_provider() {
     DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
@@ -271,9 +271,7 @@ void AssetDiscoveryManager::DiscoverEthAssets(
 
   std::vector<mojom::BlockchainTokenPtr> user_assets =
       BraveWalletService::GetUserAssets(prefs_);
-  TokenListMap token_list_map =
-      BlockchainRegistry::GetInstance()->GetEthTokenListMap(
-          GetAssetDiscoverySupportedEthChains());
+  auto* blockchain_registry = BlockchainRegistry::GetInstance();
 
   // Create set of all user assets per chain to use to ensure we don't
   // include assets the user has already added in the call to the BalanceScanner
@@ -284,28 +282,22 @@ void AssetDiscoveryManager::DiscoverEthAssets(
         user_asset->contract_address);
   }
 
-  // Create a map of chain_id to a map contract address to BlockchainToken
-  // to easily lookup tokens by contract address when the results of the
-  // BalanceScanner calls are merged
-  base::flat_map<std::string,
-                 base::flat_map<std::string, mojom::BlockchainTokenPtr>>
-      chain_id_to_contract_address_to_token;
-
   // Create a map of chain_id to a vector of contract addresses (strings, rather
-  // than BlockchainTokens) to pass to GetERC20TokenBalances
+  // than BlockchainTokens) to pass to GetERC20TokenBalances. Tokens are read
+  // from the registry in place, only the discovered ones get copied later in
+  // MergeDiscoveredEthAssets.
   base::flat_map<std::string, std::vector<std::string>>
       chain_id_to_contract_addresses;
-
-  // Populate the chain_id_to_contract_addresses using the token_list_map of
-  // BlockchainTokenPtrs
-  for (auto& [chain_id, token_list] : token_list_map) {
-    for (auto& token : token_list) {
+  for (const auto& chain_id : GetAssetDiscoverySupportedEthChains()) {
+    const auto* token_list =
+        blockchain_registry->GetTokenList(chain_id, mojom::CoinType::ETH);
+    if (!token_list) {
+      continue;
+    }
+    for (const auto& token : *token_list) {
       if (!user_assets_per_chain[chain_id].contains(token->contract_address)) {
         chain_id_to_contract_addresses[chain_id].push_back(
             token->contract_address);
-        chain_id_to_contract_address_to_token[chain_id]
-                                             [token->contract_address] =
-                                                 std::move(token);
       }
     }
   }
@@ -317,7 +309,6 @@ void AssetDiscoveryManager::DiscoverEthAssets(
           account_addresses.size() * chain_id_to_contract_addresses.size(),
           base::BindOnce(&AssetDiscoveryManager::MergeDiscoveredEthAssets,
                          weak_ptr_factory_.GetWeakPtr(),
-                         std::move(chain_id_to_contract_address_to_token),
                          triggered_by_accounts_added));
 
   // For each account address, call GetERC20TokenBalances for each chain ID
@@ -373,9 +364,6 @@ void AssetDiscoveryManager::OnGetERC20TokenBalances(
 }
 
 void AssetDiscoveryManager::MergeDiscoveredEthAssets(
-    base::flat_map<std::string,
-                   base::flat_map<std::string, mojom::BlockchainTokenPtr>>
-        chain_id_to_contract_address_to_token,
     bool triggered_by_accounts_added,
     const std::vector<std::map<std::string, std::vector<std::string>>>&
         discovered_assets_results) {
@@ -396,8 +384,8 @@ void AssetDiscoveryManager::MergeDiscoveredEthAssets(
 
         // Add to seen and discovered_tokens if not
         seen_contract_addresses[chain_id].insert(contract_address);
-        auto token = std::move(
-            chain_id_to_contract_address_to_token[chain_id][contract_address]);
+        auto token = BlockchainRegistry::GetInstance()->GetTokenByAddress(
+            chain_id, mojom::CoinType::ETH, contract_address);
         if (token && BraveWalletService::AddUserAsset(token.Clone(), prefs_)) {
           discovered_tokens.push_back(std::move(token));
         }
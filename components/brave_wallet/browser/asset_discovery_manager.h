@@ -126,9 +126,6 @@ class AssetDiscoveryManager : public mojom::KeyringServiceObserver {
       const std::string& error_message);
 
   void MergeDiscoveredEthAssets(
-      base::flat_map<std::string,
-                     base::flat_map<std::string, mojom::BlockchainTokenPtr>>
-          chain_id_to_contract_address_to_token,
       bool triggered_by_accounts_added,
       const std::vector<std::map<std::string, std::vector<std::string>>>&
           discovered_assets);
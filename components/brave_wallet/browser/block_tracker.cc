@@ -5,7 +5,9 @@
 
 #include "brave/components/brave_wallet/browser/block_tracker.h"
 
-#include "base/containers/contains.h"
+#include <utility>
+
+#include "brave/components/brave_wallet/browser/block_tracker_scheduler.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 
 namespace brave_wallet {
@@ -13,25 +15,50 @@ namespace brave_wallet {
 BlockTracker::BlockTracker(JsonRpcService* json_rpc_service)
     : json_rpc_service_(json_rpc_service) {
   DCHECK(json_rpc_service_);
+  scheduler_ = json_rpc_service_->block_tracker_scheduler()->GetWeakPtr();
 }
 
-BlockTracker::~BlockTracker() = default;
+BlockTracker::~BlockTracker() {
+  if (scheduler_) {
+    scheduler_->StopPolling(this);
+  }
+}
 
 void BlockTracker::Stop(const std::string& chain_id) {
-  if (base::Contains(timers_, chain_id)) {
-    timers_.erase(chain_id);
+  if (scheduler_) {
+    scheduler_->StopPolling(this, chain_id);
   }
 }
 
 void BlockTracker::Stop() {
-  timers_.clear();
+  if (scheduler_) {
+    scheduler_->StopPolling(this);
+  }
 }
 
 bool BlockTracker::IsRunning(const std::string& chain_id) const {
-  if (!base::Contains(timers_, chain_id)) {
-    return false;
+  return scheduler_ && scheduler_->IsPolling(this, chain_id);
+}
+
+base::TimeDelta BlockTracker::GetCurrentIntervalForTesting(
+    const std::string& chain_id) const {
+  return scheduler_ ? scheduler_->GetCurrentInterval(this, chain_id)
+                    : base::TimeDelta();
+}
+
+void BlockTracker::StartPolling(const std::string& chain_id,
+                                base::TimeDelta interval,
+                                base::RepeatingClosure poll) {
+  if (scheduler_) {
+    scheduler_->StartPolling(this, chain_id, interval, std::move(poll));
+  }
+}
+
+void BlockTracker::OnPollResult(const std::string& chain_id,
+                                bool has_new_block) {
+  if (scheduler_) {
+    scheduler_->OnPollResult(this, chain_id, has_new_block);
   }
-  return timers_.at(chain_id)->IsRunning();
 }
 
 }  // namespace brave_wallet
@@ -6,16 +6,16 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCK_TRACKER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCK_TRACKER_H_
 
-#include <map>
-#include <memory>
 #include <string>
 
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/time/time.h"
-#include "base/timer/timer.h"
 
 namespace brave_wallet {
 
+class BlockTrackerScheduler;
 class JsonRpcService;
 
 class BlockTracker {
@@ -28,10 +28,28 @@ class BlockTracker {
   virtual void Stop();
   bool IsRunning(const std::string& chain_id) const;
 
+  // Interval the chain is currently polled at, including idle backoff.
+  base::TimeDelta GetCurrentIntervalForTesting(
+      const std::string& chain_id) const;
+
  protected:
-  // <chain_id, timer>
-  std::map<std::string, std::unique_ptr<base::RepeatingTimer>> timers_;
+  // Polls |chain_id| with |poll| every |interval|. The chains of all block
+  // trackers using |json_rpc_service_| share its BlockTrackerScheduler, see
+  // BlockTrackerScheduler::StartPolling(). If the chain is already polled,
+  // its interval and schedule are reset.
+  void StartPolling(const std::string& chain_id,
+                    base::TimeDelta interval,
+                    base::RepeatingClosure poll);
+  // Subclasses report whether a poll saw a new block. A chain that keeps
+  // seeing the same block is polled less often until it sees a new one.
+  void OnPollResult(const std::string& chain_id, bool has_new_block);
+
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
+
+ private:
+  // The scheduler of |json_rpc_service_|, which can be destroyed before this
+  // tracker during shutdown.
+  base::WeakPtr<BlockTrackerScheduler> scheduler_;
 };
 
 }  // namespace brave_wallet
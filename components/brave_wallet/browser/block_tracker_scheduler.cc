@@ -0,0 +1,159 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/block_tracker_scheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "base/containers/contains.h"
+#include "base/containers/cxx20_erase.h"
+#include "base/functional/bind.h"
+#include "base/metrics/histogram_functions.h"
+
+namespace brave_wallet {
+
+namespace {
+
+// Chains due within this much of a wake-up are polled early in that wake-up.
+constexpr base::TimeDelta kAlignmentSlack = base::Seconds(1);
+// Consecutive polls without a new block before the interval starts doubling.
+constexpr size_t kIdlePollsBeforeBackoff = 5;
+// Upper bound of the backed off interval, as a multiple of the requested one.
+constexpr int kMaxBackoffMultiplier = 4;
+
+constexpr char kWakeUpsPerHourHistogramName[] =
+    "Brave.Wallet.BlockTrackerWakeUpsPerHour";
+
+}  // namespace
+
+BlockTrackerScheduler::PollingState::PollingState() = default;
+BlockTrackerScheduler::PollingState::~PollingState() = default;
+BlockTrackerScheduler::PollingState::PollingState(PollingState&&) = default;
+BlockTrackerScheduler::PollingState&
+BlockTrackerScheduler::PollingState::operator=(PollingState&&) = default;
+
+BlockTrackerScheduler::BlockTrackerScheduler() = default;
+
+BlockTrackerScheduler::~BlockTrackerScheduler() = default;
+
+void BlockTrackerScheduler::StartPolling(const BlockTracker* tracker,
+                                         const std::string& chain_id,
+                                         base::TimeDelta interval,
+                                         base::RepeatingClosure poll) {
+  auto& state = chains_[{tracker, chain_id}];
+  state.interval = interval;
+  state.current_interval = interval;
+  state.next_poll = base::TimeTicks::Now() + interval;
+  state.idle_polls = 0;
+  state.poll = std::move(poll);
+  ScheduleNextWakeUp();
+}
+
+void BlockTrackerScheduler::StopPolling(const BlockTracker* tracker,
+                                        const std::string& chain_id) {
+  chains_.erase({tracker, chain_id});
+  ScheduleNextWakeUp();
+}
+
+void BlockTrackerScheduler::StopPolling(const BlockTracker* tracker) {
+  base::EraseIf(chains_, [tracker](const auto& chain) {
+    return chain.first.first == tracker;
+  });
+  ScheduleNextWakeUp();
+}
+
+bool BlockTrackerScheduler::IsPolling(const BlockTracker* tracker,
+                                      const std::string& chain_id) const {
+  return base::Contains(chains_, ChainKey(tracker, chain_id));
+}
+
+void BlockTrackerScheduler::OnPollResult(const BlockTracker* tracker,
+                                         const std::string& chain_id,
+                                         bool has_new_block) {
+  auto it = chains_.find({tracker, chain_id});
+  if (it == chains_.end()) {
+    return;
+  }
+
+  auto& state = it->second;
+  if (has_new_block) {
+    state.idle_polls = 0;
+    state.current_interval = state.interval;
+    return;
+  }
+
+  if (++state.idle_polls >= kIdlePollsBeforeBackoff) {
+    state.current_interval = std::min(state.current_interval * 2,
+                                      state.interval * kMaxBackoffMultiplier);
+  }
+}
+
+base::TimeDelta BlockTrackerScheduler::GetCurrentInterval(
+    const BlockTracker* tracker,
+    const std::string& chain_id) const {
+  auto it = chains_.find({tracker, chain_id});
+  return it == chains_.end() ? base::TimeDelta() : it->second.current_interval;
+}
+
+base::WeakPtr<BlockTrackerScheduler> BlockTrackerScheduler::GetWeakPtr() {
+  return weak_ptr_factory_.GetWeakPtr();
+}
+
+void BlockTrackerScheduler::ScheduleNextWakeUp() {
+  if (chains_.empty()) {
+    timer_.Stop();
+    wake_ups_metric_timer_.Stop();
+    wake_ups_in_window_ = 0;
+    return;
+  }
+
+  if (!wake_ups_metric_timer_.IsRunning()) {
+    wake_ups_metric_timer_.Start(
+        FROM_HERE, base::Hours(1),
+        base::BindRepeating(&BlockTrackerScheduler::RecordWakeUpsPerHour,
+                            base::Unretained(this)));
+  }
+
+  base::TimeTicks next_wake_up = base::TimeTicks::Max();
+  for (const auto& [key, state] : chains_) {
+    next_wake_up = std::min(next_wake_up, state.next_poll);
+  }
+  timer_.Start(
+      FROM_HERE,
+      std::max(next_wake_up - base::TimeTicks::Now(), base::TimeDelta()),
+      base::BindOnce(&BlockTrackerScheduler::OnWakeUp,
+                     base::Unretained(this)));
+}
+
+void BlockTrackerScheduler::OnWakeUp() {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  ++wake_ups_in_window_;
+
+  // Polls only issue async requests, but collect them first so that a
+  // tracker stopping a chain from a poll can't invalidate the iteration.
+  std::vector<base::RepeatingClosure> polls;
+  for (auto& [key, state] : chains_) {
+    const base::TimeDelta slack =
+        std::min(kAlignmentSlack, state.current_interval / 4);
+    if (state.next_poll - now <= slack) {
+      state.next_poll = now + state.current_interval;
+      polls.push_back(state.poll);
+    }
+  }
+  ScheduleNextWakeUp();
+
+  for (const auto& poll : polls) {
+    poll.Run();
+  }
+}
+
+void BlockTrackerScheduler::RecordWakeUpsPerHour() {
+  base::UmaHistogramCounts10000(kWakeUpsPerHourHistogramName,
+                                wake_ups_in_window_);
+  wake_ups_in_window_ = 0;
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,94 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCK_TRACKER_SCHEDULER_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCK_TRACKER_SCHEDULER_H_
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+
+namespace brave_wallet {
+
+class BlockTracker;
+
+// Polls the chains of all block trackers of a profile from a single timer,
+// so that Ethereum, Solana and Filecoin chains which are due at about the
+// same time are polled in the same wake-up.
+//
+// Owned by JsonRpcService. Block trackers hold it through a WeakPtr, as
+// keyed services and the trackers they own may be destroyed after it.
+class BlockTrackerScheduler {
+ public:
+  BlockTrackerScheduler();
+  ~BlockTrackerScheduler();
+
+  BlockTrackerScheduler(const BlockTrackerScheduler&) = delete;
+  BlockTrackerScheduler& operator=(const BlockTrackerScheduler&) = delete;
+
+  // Polls |chain_id| of |tracker| with |poll| every |interval|. Chains that
+  // are due shortly after the one being woken for are polled in the same
+  // wake-up. If the chain is already polled, its interval and schedule are
+  // reset.
+  void StartPolling(const BlockTracker* tracker,
+                    const std::string& chain_id,
+                    base::TimeDelta interval,
+                    base::RepeatingClosure poll);
+  void StopPolling(const BlockTracker* tracker, const std::string& chain_id);
+  // Stops polling all chains of |tracker|.
+  void StopPolling(const BlockTracker* tracker);
+  bool IsPolling(const BlockTracker* tracker,
+                 const std::string& chain_id) const;
+
+  // A chain that keeps seeing the same block is polled less often until it
+  // sees a new one.
+  void OnPollResult(const BlockTracker* tracker,
+                    const std::string& chain_id,
+                    bool has_new_block);
+
+  // Interval the chain is currently polled at, including idle backoff.
+  base::TimeDelta GetCurrentInterval(const BlockTracker* tracker,
+                                     const std::string& chain_id) const;
+
+  base::WeakPtr<BlockTrackerScheduler> GetWeakPtr();
+
+ private:
+  struct PollingState {
+    PollingState();
+    ~PollingState();
+    PollingState(PollingState&&);
+    PollingState& operator=(PollingState&&);
+
+    base::TimeDelta interval;
+    base::TimeDelta current_interval;
+    base::TimeTicks next_poll;
+    size_t idle_polls = 0;
+    base::RepeatingClosure poll;
+  };
+
+  using ChainKey = std::pair<const BlockTracker*, std::string>;
+
+  void ScheduleNextWakeUp();
+  void OnWakeUp();
+  void RecordWakeUpsPerHour();
+
+  std::map<ChainKey, PollingState> chains_;
+  base::OneShotTimer timer_;
+  // Runs while any chain is polled, the wake-ups of a partial hour are
+  // dropped when polling stops.
+  base::RepeatingTimer wake_ups_metric_timer_;
+  size_t wake_ups_in_window_ = 0;
+
+  base::WeakPtrFactory<BlockTrackerScheduler> weak_ptr_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCK_TRACKER_SCHEDULER_H_
@@ -5,10 +5,11 @@
 
 #include "brave/components/brave_wallet/browser/blockchain_registry.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/containers/flat_set.h"
-#include "base/ranges/algorithm.h"
+#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -17,6 +18,20 @@
 
 namespace brave_wallet {
 
+namespace {
+
+// EVM addresses are matched case-insensitively since lists and callers mix
+// checksummed and lowercase forms. Other chains use case-sensitive encodings
+// (none of which can start with 0x) and are matched verbatim.
+std::string NormalizeTokenAddress(const std::string& address) {
+  if (base::StartsWith(address, "0x")) {
+    return base::ToLowerASCII(address);
+  }
+  return address;
+}
+
+}  // namespace
+
 BlockchainRegistry::BlockchainRegistry() = default;
 BlockchainRegistry::~BlockchainRegistry() = default;
 
@@ -38,12 +53,58 @@ void BlockchainRegistry::Bind(
 
 void BlockchainRegistry::UpdateTokenList(TokenListMap token_list_map) {
   token_list_map_ = std::move(token_list_map);
+  token_address_index_.clear();
+  token_symbol_index_.clear();
+  for (const auto& [key, tokens] : token_list_map_) {
+    IndexTokenList(key);
+  }
 }
 
 void BlockchainRegistry::UpdateTokenList(
     const std::string key,
     std::vector<mojom::BlockchainTokenPtr> list) {
   token_list_map_[key] = std::move(list);
+  IndexTokenList(key);
+}
+
+void BlockchainRegistry::IndexTokenList(const std::string& key) {
+  const auto& tokens = token_list_map_[key];
+  std::vector<std::pair<std::string, size_t>> by_address;
+  std::vector<std::pair<std::string, size_t>> by_symbol;
+  by_address.reserve(tokens.size());
+  by_symbol.reserve(tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    by_address.emplace_back(NormalizeTokenAddress(tokens[i]->contract_address),
+                            i);
+    by_symbol.emplace_back(tokens[i]->symbol, i);
+  }
+  // flat_map keeps the first of duplicate keys, so lookups still resolve to
+  // the earliest entry in the list.
+  token_address_index_[key] =
+      base::flat_map<std::string, size_t>(std::move(by_address));
+  token_symbol_index_[key] =
+      base::flat_map<std::string, size_t>(std::move(by_symbol));
+}
+
+const mojom::BlockchainTokenPtr* BlockchainRegistry::FindIndexedToken(
+    const base::flat_map<std::string, base::flat_map<std::string, size_t>>&
+        index,
+    const std::string& key,
+    const std::string& value) const {
+  auto list_it = index.find(key);
+  if (list_it == index.end()) {
+    return nullptr;
+  }
+  auto token_it = list_it->second.find(value);
+  if (token_it == list_it->second.end()) {
+    return nullptr;
+  }
+  auto tokens_it = token_list_map_.find(key);
+  if (tokens_it == token_list_map_.end() ||
+      token_it->second >= tokens_it->second.size()) {
+    return nullptr;
+  }
+  return &tokens_it->second[token_it->second];
 }
 
 void BlockchainRegistry::UpdateChainList(ChainList chains) {
@@ -61,39 +122,26 @@ mojom::BlockchainTokenPtr BlockchainRegistry::GetTokenByAddress(
     const std::string& chain_id,
     mojom::CoinType coin,
     const std::string& address) {
-  const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key))
-    return nullptr;
+  const auto* token =
+      FindIndexedToken(token_address_index_, GetTokenListKey(coin, chain_id),
+                       NormalizeTokenAddress(address));
+  return token ? token->Clone() : nullptr;
+}
 
-  const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->contract_address == address;
-      });
-  return token_it == tokens.end() ? nullptr : token_it->Clone();
+const std::vector<mojom::BlockchainTokenPtr>* BlockchainRegistry::GetTokenList(
+    const std::string& chain_id,
+    mojom::CoinType coin) const {
+  auto it = token_list_map_.find(GetTokenListKey(coin, chain_id));
+  return it == token_list_map_.end() ? nullptr : &it->second;
 }
 
 void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
                                           mojom::CoinType coin,
                                           const std::string& symbol,
                                           GetTokenBySymbolCallback callback) {
-  const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
-    std::move(callback).Run(nullptr);
-    return;
-  }
-  const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->symbol == symbol;
-      });
-
-  if (token_it == tokens.end()) {
-    std::move(callback).Run(nullptr);
-    return;
-  }
-
-  std::move(callback).Run(token_it->Clone());
+  const auto* token = FindIndexedToken(
+      token_symbol_index_, GetTokenListKey(coin, chain_id), symbol);
+  std::move(callback).Run(token ? token->Clone() : nullptr);
 }
 
 void BlockchainRegistry::GetAllTokens(const std::string& chain_id,
@@ -142,33 +190,6 @@ std::vector<mojom::BlockchainTokenPtr> BlockchainRegistry::GetBuyTokens(
   return blockchain_buy_tokens;
 }
 
-TokenListMap BlockchainRegistry::GetEthTokenListMap(
-    const std::vector<std::string>& chain_ids) {
-  // Create a copy of token_list_map with only the chain_ids we want
-  TokenListMap token_list_map_copy;
-  for (const auto& chain_id : chain_ids) {
-    const auto key = GetTokenListKey(mojom::CoinType::ETH, chain_id);
-    // Skip if the key is not in the map.
-    if (!token_list_map_.contains(key)) {
-      continue;
-    }
-
-    // Otherwise, clone the vector of tokens.
-    const auto& tokens = token_list_map_[key];
-    std::vector<brave_wallet::mojom::BlockchainTokenPtr> tokens_copy(
-        tokens.size());
-    std::transform(
-        tokens.begin(), tokens.end(), tokens_copy.begin(),
-        [](const brave_wallet::mojom::BlockchainTokenPtr& current_token)
-            -> brave_wallet::mojom::BlockchainTokenPtr {
-          return current_token.Clone();
-        });
-    token_list_map_copy[chain_id] = std::move(tokens_copy);
-  }
-
-  return token_list_map_copy;
-}
-
 void BlockchainRegistry::GetBuyTokens(mojom::OnRampProvider provider,
                                       const std::string& chain_id,
                                       GetBuyTokensCallback callback) {
@@ -7,8 +7,10 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCKCHAIN_REGISTRY_H_
 
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/singleton.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -37,6 +39,12 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   mojom::BlockchainTokenPtr GetTokenByAddress(const std::string& chain_id,
                                               mojom::CoinType coin,
                                               const std::string& address);
+  // Returns the registry-owned token list for the chain without copying it,
+  // or nullptr if there is none. The list is only valid until the next
+  // UpdateTokenList call, so it must not be held across tasks.
+  const std::vector<mojom::BlockchainTokenPtr>* GetTokenList(
+      const std::string& chain_id,
+      mojom::CoinType coin) const;
   std::vector<mojom::NetworkInfoPtr> GetPrepopulatedNetworks();
 
   // BlockchainRegistry interface methods
@@ -51,7 +59,6 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   void GetAllTokens(const std::string& chain_id,
                     mojom::CoinType coin,
                     GetAllTokensCallback callback) override;
-  TokenListMap GetEthTokenListMap(const std::vector<std::string>& chain_ids);
   void GetBuyTokens(mojom::OnRampProvider provider,
                     const std::string& chain_id,
                     GetBuyTokensCallback callback) override;
@@ -67,10 +74,23 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
       GetPrepopulatedNetworksCallback callback) override;
 
  protected:
-  std::vector<mojom::BlockchainTokenPtr>* GetTokenListFromChainId(
-      const std::string& chain_id);
+  // Rebuilds the address and symbol indexes of the token list stored under
+  // |key| in |token_list_map_|.
+  void IndexTokenList(const std::string& key);
+  const mojom::BlockchainTokenPtr* FindIndexedToken(
+      const base::flat_map<std::string, base::flat_map<std::string, size_t>>&
+          index,
+      const std::string& key,
+      const std::string& value) const;
 
   TokenListMap token_list_map_;
+  // Token list key -> lowercase 0x address (or verbatim address for non-EVM
+  // chains) -> position in the token list.
+  base::flat_map<std::string, base::flat_map<std::string, size_t>>
+      token_address_index_;
+  // Token list key -> symbol -> position in the token list.
+  base::flat_map<std::string, base::flat_map<std::string, size_t>>
+      token_symbol_index_;
   ChainList chain_list_;
   friend struct base::DefaultSingletonTraits<BlockchainRegistry>;
 
@@ -78,6 +98,8 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
 
  private:
   mojo::ReceiverSet<mojom::BlockchainRegistry> receivers_;
+  // Only called to reply to mojo callbacks, which take ownership of the
+  // tokens, so the tokens matching |chain_id| are copied.
   std::vector<brave_wallet::mojom::BlockchainTokenPtr> GetBuyTokens(
       const std::vector<mojom::OnRampProvider>& providers,
       const std::string& chain_id);
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
@@ -336,6 +337,23 @@ TEST(BlockchainRegistryUnitTest, GetTokenByAddress) {
       }));
   run_loop4.Run();
 
+  // EVM addresses are matched regardless of checksum casing
+  base::RunLoop run_loop6;
+  registry->GetTokenByAddress(
+      mojom::kMainnetChainId, mojom::CoinType::ETH,
+      "0x0d8775f648430679a709e98d2b0cb6250d2887ef",
+      base::BindLambdaForTesting([&](mojom::BlockchainTokenPtr token) {
+        ASSERT_TRUE(token);
+        EXPECT_EQ(token->symbol, "BAT");
+        run_loop6.Quit();
+      }));
+  run_loop6.Run();
+
+  // Non-EVM addresses are case sensitive
+  EXPECT_FALSE(registry->GetTokenByAddress(
+      mojom::kSolanaMainnet, mojom::CoinType::SOL,
+      "epjfwdd5aufqssqem2qn1xzybapc8g4wegkzwytdt1v"));
+
   // Get Solana token
   base::RunLoop run_loop5;
   registry->GetTokenByAddress(
@@ -542,7 +560,7 @@ TEST(BlockchainRegistryUnitTest, GetPrepopulatedNetworksKnownOnesArePreferred) {
   EXPECT_EQ(found_networks[0]->chain_name, "Ethereum Mainnet");
 }
 
-TEST(BlockchainRegistryUnitTest, GetEthTokenListMap) {
+TEST(BlockchainRegistryUnitTest, GetTokenList) {
   base::test::TaskEnvironment task_environment;
   auto* registry = BlockchainRegistry::GetInstance();
   TokenListMap token_list_map;
@@ -550,13 +568,58 @@ TEST(BlockchainRegistryUnitTest, GetEthTokenListMap) {
       ParseTokenList(token_list_json, &token_list_map, mojom::CoinType::ETH));
   registry->UpdateTokenList(std::move(token_list_map));
 
-  // Loop twice to make sure getting the same list twice works
-  // For example, make sure nothing is std::move'd
-  for (size_t i = 0; i < 2; i++) {
-    token_list_map = registry->GetEthTokenListMap({mojom::kMainnetChainId});
-    EXPECT_EQ(token_list_map.size(), 1UL);
-    EXPECT_EQ(token_list_map[mojom::kMainnetChainId].size(), 2UL);
+  const auto* token_list =
+      registry->GetTokenList(mojom::kMainnetChainId, mojom::CoinType::ETH);
+  ASSERT_TRUE(token_list);
+  EXPECT_EQ(token_list->size(), 2UL);
+  // Returns the same registry-owned list on each call.
+  EXPECT_EQ(token_list, registry->GetTokenList(mojom::kMainnetChainId,
+                                               mojom::CoinType::ETH));
+  EXPECT_FALSE(
+      registry->GetTokenList(mojom::kSepoliaChainId, mojom::CoinType::ETH));
+}
+
+TEST(BlockchainRegistryUnitTest, IndexedLookupsOnLargeTokenList) {
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+
+  const size_t kTokenCount = 10000;
+  std::vector<mojom::BlockchainTokenPtr> tokens;
+  for (size_t i = 0; i < kTokenCount; ++i) {
+    auto token = mojom::BlockchainToken::New();
+    token->contract_address = base::StringPrintf("0x%040zX", i);
+    token->symbol = base::StringPrintf("TKN%zu", i);
+    token->chain_id = mojom::kMainnetChainId;
+    token->coin = mojom::CoinType::ETH;
+    tokens.push_back(std::move(token));
   }
+  // Duplicate symbol resolves to the first entry, as a linear scan would.
+  auto duplicate = tokens[1]->Clone();
+  duplicate->contract_address = "0xdeadbeef";
+  tokens.push_back(std::move(duplicate));
+
+  registry->UpdateTokenList(
+      GetTokenListKey(mojom::CoinType::ETH, mojom::kMainnetChainId),
+      std::move(tokens));
+
+  for (size_t i = 0; i < kTokenCount; i += 997) {
+    auto token = registry->GetTokenByAddress(
+        mojom::kMainnetChainId, mojom::CoinType::ETH,
+        base::StringPrintf("0x%040zx", i));
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->symbol, base::StringPrintf("TKN%zu", i));
+  }
+
+  base::RunLoop run_loop;
+  registry->GetTokenBySymbol(
+      mojom::kMainnetChainId, mojom::CoinType::ETH, "TKN1",
+      base::BindLambdaForTesting([&](mojom::BlockchainTokenPtr token) {
+        ASSERT_TRUE(token);
+        EXPECT_EQ(token->contract_address,
+                  base::StringPrintf("0x%040zX", size_t{1}));
+        run_loop.Quit();
+      }));
+  run_loop.Run();
 }
 
 }  // namespace brave_wallet
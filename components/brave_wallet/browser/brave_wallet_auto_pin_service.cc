@@ -5,10 +5,27 @@
 
 #include "brave/components/brave_wallet/browser/brave_wallet_auto_pin_service.h"
 
+#include <algorithm>
+
+#include "base/metrics/histogram_functions.h"
+#include "base/ranges/algorithm.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 
 namespace brave_wallet {
 namespace {
+
+// Metadata fetches and content type checks are network bound, so a few tokens
+// are processed at once. Pinning itself is serialized by the local node jobs.
+constexpr size_t kMaxParallelTasks = 4;
+
+// Failed tasks are retried after 2, 4, 8... minutes, up to an hour.
+constexpr base::TimeDelta kRetryBaseDelay = base::Minutes(2);
+constexpr base::TimeDelta kMaxRetryDelay = base::Hours(1);
+
+constexpr char kBatchSizeHistogramName[] = "Brave.Wallet.AutoPin.BatchSize";
+constexpr char kBatchDurationHistogramName[] =
+    "Brave.Wallet.AutoPin.BatchDuration";
+
 bool ShouldRetryOnError(const mojom::PinErrorPtr& error) {
   return !error || error->error_code !=
                        mojom::WalletPinServiceErrorCode::ERR_NON_IPFS_TOKEN_URL;
@@ -73,7 +90,9 @@ void BraveWalletAutoPinService::ResetLocalState() {
   tasks_weak_ptr_factory_.InvalidateWeakPtrs();
   tokens_.clear();
   queue_.clear();
-  current_.reset();
+  in_progress_.clear();
+  batch_start_time_ = base::TimeTicks();
+  batch_finished_tasks_ = 0;
 }
 
 void BraveWalletAutoPinService::Reset() {
@@ -225,28 +244,25 @@ void BraveWalletAutoPinService::OnTokenListResolved(
   CheckQueue();
 }
 
-void BraveWalletAutoPinService::ValidateToken(
-    const std::unique_ptr<IntentData>& data) {
+void BraveWalletAutoPinService::ValidateToken(IntentList::iterator it) {
   brave_wallet_pin_service_->Validate(
-      data->token->Clone(), data->service,
+      (*it)->token->Clone(), (*it)->service,
       base::BindOnce(&BraveWalletAutoPinService::OnValidateTaskFinished,
-                     tasks_weak_ptr_factory_.GetWeakPtr()));
+                     tasks_weak_ptr_factory_.GetWeakPtr(), it));
 }
 
-void BraveWalletAutoPinService::PinToken(
-    const std::unique_ptr<IntentData>& data) {
+void BraveWalletAutoPinService::PinToken(IntentList::iterator it) {
   brave_wallet_pin_service_->AddPin(
-      data->token->Clone(), data->service,
+      (*it)->token->Clone(), (*it)->service,
       base::BindOnce(&BraveWalletAutoPinService::OnTaskFinished,
-                     tasks_weak_ptr_factory_.GetWeakPtr()));
+                     tasks_weak_ptr_factory_.GetWeakPtr(), it));
 }
 
-void BraveWalletAutoPinService::UnpinToken(
-    const std::unique_ptr<IntentData>& data) {
+void BraveWalletAutoPinService::UnpinToken(IntentList::iterator it) {
   brave_wallet_pin_service_->RemovePin(
-      data->token->Clone(), data->service,
+      (*it)->token->Clone(), (*it)->service,
       base::BindOnce(&BraveWalletAutoPinService::OnTaskFinished,
-                     tasks_weak_ptr_factory_.GetWeakPtr()));
+                     tasks_weak_ptr_factory_.GetWeakPtr(), it));
 }
 
 void BraveWalletAutoPinService::AddOrExecute(std::unique_ptr<IntentData> data) {
@@ -259,7 +275,7 @@ void BraveWalletAutoPinService::AddOrExecute(std::unique_ptr<IntentData> data) {
       return;
     }
   }
-  if (current_ && current_->Equals(data)) {
+  if (IsInProgress(data)) {
     return;
   }
 
@@ -295,53 +311,102 @@ void BraveWalletAutoPinService::PostRetry(std::unique_ptr<IntentData> data) {
   if (!IsAutoPinEnabled()) {
     return;
   }
-  int multiply = ++data->attempt;
+  const int exponent = static_cast<int>(std::min<size_t>(data->attempt++, 5));
   base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
       FROM_HERE,
       base::BindOnce(&BraveWalletAutoPinService::AddOrExecute,
                      tasks_weak_ptr_factory_.GetWeakPtr(), std::move(data)),
-      base::Minutes(2 * multiply));
+      std::min(kRetryBaseDelay * (1 << exponent), kMaxRetryDelay));
+}
+
+bool BraveWalletAutoPinService::IsInProgress(
+    const std::unique_ptr<IntentData>& data) {
+  return base::ranges::any_of(in_progress_, [&data](const auto& intent) {
+    return intent->Equals(data);
+  });
+}
+
+bool BraveWalletAutoPinService::IsTokenInProgress(
+    const std::unique_ptr<IntentData>& data) {
+  const auto path =
+      BraveWalletPinService::GetTokenPrefPath(data->service, data->token);
+  return base::ranges::any_of(in_progress_, [&path](const auto& intent) {
+    return BraveWalletPinService::GetTokenPrefPath(intent->service,
+                                                   intent->token) == path;
+  });
 }
 
 void BraveWalletAutoPinService::CheckQueue() {
   if (!IsAutoPinEnabled()) {
     return;
   }
-  if (queue_.empty() || current_) {
-    return;
-  }
 
-  current_ = std::move(queue_.front());
-  queue_.pop_front();
+  while (in_progress_.size() < kMaxParallelTasks) {
+    // Intents for a token which is being processed stay queued until that
+    // task finishes, the rest of the queue can go ahead.
+    auto queue_it =
+        base::ranges::find_if(queue_, [this](const auto& intent) {
+          return !IsTokenInProgress(intent);
+        });
+    if (queue_it == queue_.end()) {
+      break;
+    }
+
+    if (batch_start_time_.is_null()) {
+      batch_start_time_ = base::TimeTicks::Now();
+    }
+
+    auto it = in_progress_.insert(in_progress_.end(), std::move(*queue_it));
+    queue_.erase(queue_it);
 
-  if (current_->operation == Operation::kAdd) {
-    PinToken(current_);
-  } else if (current_->operation == Operation::kDelete) {
-    UnpinToken(current_);
-  } else if (current_->operation == Operation::kValidate) {
-    ValidateToken(current_);
+    if ((*it)->operation == Operation::kAdd) {
+      PinToken(it);
+    } else if ((*it)->operation == Operation::kDelete) {
+      UnpinToken(it);
+    } else if ((*it)->operation == Operation::kValidate) {
+      ValidateToken(it);
+    }
+  }
+
+  if (queue_.empty() && in_progress_.empty() && !batch_start_time_.is_null()) {
+    RecordBatchFinished();
   }
 }
 
-void BraveWalletAutoPinService::OnTaskFinished(bool result,
+void BraveWalletAutoPinService::RecordBatchFinished() {
+  base::UmaHistogramCounts1000(kBatchSizeHistogramName, batch_finished_tasks_);
+  base::UmaHistogramLongTimes(kBatchDurationHistogramName,
+                              base::TimeTicks::Now() - batch_start_time_);
+  batch_start_time_ = base::TimeTicks();
+  batch_finished_tasks_ = 0;
+}
+
+void BraveWalletAutoPinService::OnTaskFinished(IntentList::iterator it,
+                                               bool result,
                                                mojom::PinErrorPtr error) {
+  auto data = std::move(*it);
+  in_progress_.erase(it);
+  batch_finished_tasks_++;
+
   if (!result &&
-      (current_->operation != Operation::kAdd || ShouldRetryOnError(error))) {
-    PostRetry(std::move(current_));
+      (data->operation != Operation::kAdd || ShouldRetryOnError(error))) {
+    PostRetry(std::move(data));
   }
-  current_.reset();
   CheckQueue();
 }
 
 void BraveWalletAutoPinService::OnValidateTaskFinished(
+    IntentList::iterator it,
     mojom::TokenValidationResult result) {
+  auto data = std::move(*it);
+  in_progress_.erase(it);
+  batch_finished_tasks_++;
+
   if (result == mojom::TokenValidationResult::kValidationError) {
-    PostRetry(std::move(current_));
-  }
-  auto current = std::move(current_);
-  if (result == mojom::TokenValidationResult::kValidationFailed) {
-    AddOrExecute(std::make_unique<IntentData>(current->token, Operation::kAdd,
-                                              current->service));
+    PostRetry(std::move(data));
+  } else if (result == mojom::TokenValidationResult::kValidationFailed) {
+    AddOrExecute(std::make_unique<IntentData>(data->token, Operation::kAdd,
+                                              data->service));
   }
   CheckQueue();
 }
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BRAVE_WALLET_AUTO_PIN_SERVICE_H_
 
 #include <deque>
+#include <list>
 #include <memory>
 #include <set>
 #include <string>
@@ -66,6 +67,7 @@ class BraveWalletAutoPinService
                            QueueCleared_WhenAutoPinDisabled);
   FRIEND_TEST_ALL_PREFIXES(BraveWalletAutoPinServiceTest, RemoveQueuedTokens);
   FRIEND_TEST_ALL_PREFIXES(BraveWalletAutoPinServiceTest, AddQueuedTokens);
+  FRIEND_TEST_ALL_PREFIXES(BraveWalletAutoPinServiceTest, TasksRunInParallel);
   enum Operation { kAdd = 0, kDelete = 1, kValidate = 2 };
 
   struct IntentData {
@@ -90,19 +92,28 @@ class BraveWalletAutoPinService
   void Restore();
   void OnTokenListResolved(std::vector<BlockchainTokenPtr>);
 
+  using IntentList = std::list<std::unique_ptr<IntentData>>;
+
   void CheckQueue();
   void AddOrExecute(std::unique_ptr<IntentData> data);
   void PostRetry(std::unique_ptr<IntentData> data);
+  bool IsInProgress(const std::unique_ptr<IntentData>& data);
+  // Whether any intent for the same token and service is in progress.
+  bool IsTokenInProgress(const std::unique_ptr<IntentData>& data);
+  void RecordBatchFinished();
 
   std::vector<absl::optional<std::string>> GetServicesToPin();
   std::vector<absl::optional<std::string>> GetKnownServices();
 
-  void ValidateToken(const std::unique_ptr<IntentData>& data);
-  void PinToken(const std::unique_ptr<IntentData>& data);
-  void UnpinToken(const std::unique_ptr<IntentData>& data);
+  void ValidateToken(IntentList::iterator it);
+  void PinToken(IntentList::iterator it);
+  void UnpinToken(IntentList::iterator it);
 
-  void OnTaskFinished(bool result, mojom::PinErrorPtr error);
-  void OnValidateTaskFinished(mojom::TokenValidationResult result);
+  void OnTaskFinished(IntentList::iterator it,
+                      bool result,
+                      mojom::PinErrorPtr error);
+  void OnValidateTaskFinished(IntentList::iterator it,
+                              mojom::TokenValidationResult result);
 
   mojo::Receiver<brave_wallet::mojom::BraveWalletServiceTokenObserver>
       token_observer_{this};
@@ -116,9 +127,15 @@ class BraveWalletAutoPinService
 
   // List of all known tokens, GetTokenPrefPath representation is used
   std::set<std::string> tokens_;
-  std::unique_ptr<IntentData> current_;
+  // Tasks sent to BraveWalletPinService, at most kMaxParallelTasks.
+  IntentList in_progress_;
   std::deque<std::unique_ptr<IntentData>> queue_;
 
+  // Start of the current run of tasks, used to report throughput once the
+  // queue drains.
+  base::TimeTicks batch_start_time_;
+  size_t batch_finished_tasks_ = 0;
+
   std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
   mojo::RemoteSet<mojom::WalletAutoPinServiceObserver> observers_;
 
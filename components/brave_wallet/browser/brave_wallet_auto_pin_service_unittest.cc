@@ -10,7 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/time/time_override.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_pin_service.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
@@ -580,10 +582,12 @@ TEST_F(BraveWalletAutoPinServiceTest, QueueCleared_WhenAutoPinDisabled) {
       }));
   BraveWalletAutoPinService auto_pin_service(
       GetPrefs(), GetBraveWalletService(), GetBraveWalletPinService());
-  // First one is in progress
-  EXPECT_EQ(auto_pin_service.queue_.size(), 2u);
+  // All of them are in progress
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 3u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 0u);
 
   auto_pin_service.SetAutoPinEnabled(false);
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 0u);
   EXPECT_EQ(auto_pin_service.queue_.size(), 0u);
   EXPECT_EQ(auto_pin_service.tokens_.size(), 0u);
 }
@@ -604,14 +608,17 @@ TEST_F(BraveWalletAutoPinServiceTest, RemoveQueuedTokens) {
 
   BraveWalletAutoPinService auto_pin_service(
       GetPrefs(), GetBraveWalletService(), GetBraveWalletPinService());
-  // First one is in progress
-  EXPECT_EQ(auto_pin_service.queue_.size(), 2u);
+  // All of them are in progress
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 3u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 0u);
 
   auto_pin_service.OnTokenRemoved(GetErc721Token(
       "nft.local.60.0x1.0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x1"));
 
-  EXPECT_EQ(auto_pin_service.queue_.size(), 3u);
-  EXPECT_TRUE(auto_pin_service.queue_[2u]->Equals(
+  // The removal waits for pinning of the same token to finish
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 3u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 1u);
+  EXPECT_TRUE(auto_pin_service.queue_[0u]->Equals(
       std::make_unique<BraveWalletAutoPinService::IntentData>(
           GetErc721Token("nft.local.60.0x1."
                          "0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x1"),
@@ -619,9 +626,10 @@ TEST_F(BraveWalletAutoPinServiceTest, RemoveQueuedTokens) {
   auto_pin_service.OnTokenRemoved(GetErc721Token(
       "nft.local.60.0x1.0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x3"));
 
-  EXPECT_EQ(auto_pin_service.queue_.size(), 3u);
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 3u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 2u);
 
-  EXPECT_TRUE(auto_pin_service.queue_[2u]->Equals(
+  EXPECT_TRUE(auto_pin_service.queue_[1u]->Equals(
       std::make_unique<BraveWalletAutoPinService::IntentData>(
           GetErc721Token("nft.local.60.0x1."
                          "0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x3"),
@@ -679,9 +687,10 @@ TEST_F(BraveWalletAutoPinServiceTest, AddQueuedTokens) {
   BraveWalletAutoPinService auto_pin_service(
       GetPrefs(), GetBraveWalletService(), GetBraveWalletPinService());
 
-  // First one is in progress
-  EXPECT_EQ(auto_pin_service.queue_.size(), 1u);
-  EXPECT_TRUE(auto_pin_service.queue_[0]->Equals(
+  // Pinning of 0x1 and unpinning of 0x4 are in progress
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 2u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 0u);
+  EXPECT_TRUE(auto_pin_service.in_progress_.back()->Equals(
       std::make_unique<BraveWalletAutoPinService::IntentData>(
           GetErc721Token("nft.local.60.0x1."
                          "0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x4"),
@@ -689,26 +698,124 @@ TEST_F(BraveWalletAutoPinServiceTest, AddQueuedTokens) {
 
   auto_pin_service.OnTokenAdded(GetErc721Token(
       "nft.local.60.0x1.0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x4"));
+  // Pinning of 0x4 waits for its unpinning to finish
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 2u);
   EXPECT_EQ(auto_pin_service.queue_.size(), 1u);
 
-  auto_pin_service.queue_[0u]->Equals(std::make_unique<
-                                      BraveWalletAutoPinService::IntentData>(
-      GetErc721Token(
-          "nft.local.60.0x1.0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x4"),
-      BraveWalletAutoPinService::Operation::kAdd, absl::nullopt));
+  EXPECT_TRUE(auto_pin_service.queue_[0u]->Equals(
+      std::make_unique<BraveWalletAutoPinService::IntentData>(
+          GetErc721Token("nft.local.60.0x1."
+                         "0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x4"),
+          BraveWalletAutoPinService::Operation::kAdd, absl::nullopt)));
 
   auto_pin_service.OnTokenAdded(GetErc721Token(
       "nft.local.60.0x1.0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x5"));
 
-  EXPECT_EQ(auto_pin_service.queue_.size(), 2u);
+  // Other tokens are not held back by the parked intent
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 3u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 1u);
 
-  EXPECT_TRUE(auto_pin_service.queue_[1u]->Equals(
+  EXPECT_TRUE(auto_pin_service.in_progress_.back()->Equals(
       std::make_unique<BraveWalletAutoPinService::IntentData>(
           GetErc721Token("nft.local.60.0x1."
                          "0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x5"),
           BraveWalletAutoPinService::Operation::kAdd, absl::nullopt)));
 }
 
+TEST_F(BraveWalletAutoPinServiceTest, TasksRunInParallel) {
+  base::HistogramTester histogram_tester;
+  std::vector<BraveWalletPinService::AddPinCallback> callbacks;
+  ON_CALL(*GetBraveWalletPinService(), AddPin(_, _, _))
+      .WillByDefault(::testing::Invoke(
+          [&callbacks](BlockchainTokenPtr token,
+                       const absl::optional<std::string>& service,
+                       BraveWalletPinService::AddPinCallback callback) {
+            callbacks.push_back(std::move(callback));
+          }));
+  ON_CALL(*GetBraveWalletService(), GetAllUserAssets(_))
+      .WillByDefault(::testing::Invoke(
+          [](BraveWalletService::GetUserAssetsCallback callback) {
+            std::vector<mojom::BlockchainTokenPtr> result;
+            for (int i = 1; i <= 6; i++) {
+              result.push_back(GetErc721Token(base::StringPrintf(
+                  "nft.local.60.0x1."
+                  "0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x%d",
+                  i)));
+            }
+            std::move(callback).Run(std::move(result));
+          }));
+
+  BraveWalletAutoPinService auto_pin_service(
+      GetPrefs(), GetBraveWalletService(), GetBraveWalletPinService());
+  ASSERT_EQ(callbacks.size(), 4u);
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 4u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 2u);
+
+  // Tasks may finish out of order, each finished one frees a slot.
+  std::move(callbacks[2]).Run(true, nullptr);
+  ASSERT_EQ(callbacks.size(), 5u);
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 4u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 1u);
+
+  std::move(callbacks[0]).Run(true, nullptr);
+  ASSERT_EQ(callbacks.size(), 6u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 0u);
+  histogram_tester.ExpectTotalCount("Brave.Wallet.AutoPin.BatchSize", 0);
+
+  for (size_t i : {1u, 3u, 4u, 5u}) {
+    std::move(callbacks[i]).Run(true, nullptr);
+  }
+  EXPECT_EQ(auto_pin_service.in_progress_.size(), 0u);
+  histogram_tester.ExpectUniqueSample("Brave.Wallet.AutoPin.BatchSize", 6, 1);
+  histogram_tester.ExpectTotalCount("Brave.Wallet.AutoPin.BatchDuration", 1);
+}
+
+TEST_F(BraveWalletAutoPinServiceTest, SameTokenIntentsDoNotRunInParallel) {
+  std::vector<BraveWalletPinService::AddPinCallback> add_callbacks;
+  std::vector<BraveWalletPinService::RemovePinCallback> remove_callbacks;
+  ON_CALL(*GetBraveWalletPinService(), AddPin(_, _, _))
+      .WillByDefault(::testing::Invoke(
+          [&add_callbacks](BlockchainTokenPtr token,
+                           const absl::optional<std::string>& service,
+                           BraveWalletPinService::AddPinCallback callback) {
+            add_callbacks.push_back(std::move(callback));
+          }));
+  ON_CALL(*GetBraveWalletPinService(), RemovePin(_, _, _))
+      .WillByDefault(::testing::Invoke(
+          [&remove_callbacks](
+              BlockchainTokenPtr token,
+              const absl::optional<std::string>& service,
+              BraveWalletPinService::RemovePinCallback callback) {
+            remove_callbacks.push_back(std::move(callback));
+          }));
+  ON_CALL(*GetBraveWalletService(), GetAllUserAssets(_))
+      .WillByDefault(::testing::Invoke(
+          [](BraveWalletService::GetUserAssetsCallback callback) {
+            std::vector<mojom::BlockchainTokenPtr> result;
+            result.push_back(GetErc721Token(
+                "nft.local.60.0x1."
+                "0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x1"));
+            std::move(callback).Run(std::move(result));
+          }));
+
+  BraveWalletAutoPinService auto_pin_service(
+      GetPrefs(), GetBraveWalletService(), GetBraveWalletPinService());
+  ASSERT_EQ(add_callbacks.size(), 1u);
+
+  auto_pin_service.OnTokenRemoved(GetErc721Token(
+      "nft.local.60.0x1.0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x1"));
+  auto_pin_service.OnTokenAdded(GetErc721Token(
+      "nft.local.60.0x1.0xbc4ca0eda7647a8ab7c2061c2e118a18a936f13d.0x2"));
+  // Pinning of 0x2 overtakes the parked unpinning of 0x1
+  EXPECT_EQ(add_callbacks.size(), 2u);
+  EXPECT_EQ(remove_callbacks.size(), 0u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 1u);
+
+  std::move(add_callbacks[0]).Run(true, nullptr);
+  EXPECT_EQ(remove_callbacks.size(), 1u);
+  EXPECT_EQ(auto_pin_service.queue_.size(), 0u);
+}
+
 TEST_F(BraveWalletAutoPinServiceTest, RestoreNotCalled_WhenAutoPinDisabled) {
   service()->SetAutoPinEnabled(false);
   BraveWalletAutoPinService auto_pin_service(
@@ -43,6 +43,9 @@ const char kNftPart[] = "nft";
  */
 const char kLocalService[] = "local";
 
+// Number of content type check results kept by ContentTypeChecker.
+constexpr size_t kMaxCachedContentTypeResults = 1000;
+
 absl::optional<mojom::TokenPinStatusCode> StringToStatus(
     const std::string& status) {
   if (status == "not_pinned") {
@@ -162,15 +165,29 @@ ContentTypeChecker::ContentTypeChecker(
     PrefService* pref_service,
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
     : pref_service_(pref_service),
-      url_loader_factory_(std::move(url_loader_factory)) {}
+      url_loader_factory_(std::move(url_loader_factory)),
+      results_cache_(kMaxCachedContentTypeResults) {}
 
-ContentTypeChecker::ContentTypeChecker() = default;
+ContentTypeChecker::ContentTypeChecker()
+    : results_cache_(kMaxCachedContentTypeResults) {}
 
 ContentTypeChecker::~ContentTypeChecker() = default;
 
 void ContentTypeChecker::CheckContentTypeSupported(
     const std::string& ipfs_url,
     base::OnceCallback<void(absl::optional<bool>)> callback) {
+  auto cached = results_cache_.Get(ipfs_url);
+  if (cached != results_cache_.end()) {
+    std::move(callback).Run(cached->second);
+    return;
+  }
+
+  auto pending = pending_checks_.find(ipfs_url);
+  if (pending != pending_checks_.end()) {
+    pending->second.push_back(std::move(callback));
+    return;
+  }
+
   // Create a request with no data or cookies.
   auto resource_request = std::make_unique<network::ResourceRequest>();
   GURL translated_url;
@@ -180,6 +197,7 @@ void ContentTypeChecker::CheckContentTypeSupported(
     std::move(callback).Run(false);
     return;
   }
+  pending_checks_[ipfs_url].push_back(std::move(callback));
   resource_request->url = translated_url;
   resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   resource_request->redirect_mode = ::network::mojom::RedirectMode::kFollow;
@@ -221,24 +239,34 @@ void ContentTypeChecker::CheckContentTypeSupported(
       url_loader_factory_.get(),
       base::BindOnce(&ContentTypeChecker::OnHeadersFetched,
                      weak_ptr_factory_.GetWeakPtr(), std::move(it),
-                     std::move(callback)));
+                     ipfs_url));
 }
 
 void ContentTypeChecker::OnHeadersFetched(
     UrlLoaderList::iterator loader_it,
-    base::OnceCallback<void(absl::optional<bool>)> callback,
+    const std::string& ipfs_url,
     scoped_refptr<net::HttpResponseHeaders> headers) {
   loaders_in_progress_.erase(loader_it);
-  if (!headers) {
-    std::move(callback).Run(absl::nullopt);
+
+  absl::optional<bool> result;
+  if (headers) {
+    std::string content_type_value;
+    headers->GetMimeType(&content_type_value);
+    result = base::StartsWith(content_type_value, "image/");
+    // Error pages and redirects of gateways may change, don't keep them.
+    if (headers->response_code() / 100 == 2) {
+      results_cache_.Put(ipfs_url, result.value());
+    }
+  }
+
+  auto pending = pending_checks_.find(ipfs_url);
+  if (pending == pending_checks_.end()) {
     return;
   }
-  std::string content_type_value;
-  headers->GetMimeType(&content_type_value);
-  if (base::StartsWith(content_type_value, "image/")) {
-    std::move(callback).Run(true);
-  } else {
-    std::move(callback).Run(false);
+  auto callbacks = std::move(pending->second);
+  pending_checks_.erase(pending);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(result);
   }
 }
 
@@ -13,6 +13,8 @@
 #include <vector>
 
 #include "base/containers/cxx20_erase_deque.h"
+#include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
@@ -31,6 +33,9 @@
 
 namespace brave_wallet {
 
+// Probes the content type of IPFS images before they are pinned. Tokens of
+// one collection often share an image, so concurrent checks of the same url
+// are coalesced into a single request and definitive results are cached.
 class ContentTypeChecker {
  public:
   ContentTypeChecker(
@@ -48,15 +53,20 @@ class ContentTypeChecker {
 
  private:
   using UrlLoaderList = std::list<std::unique_ptr<network::SimpleURLLoader>>;
+  using CheckCallback = base::OnceCallback<void(absl::optional<bool>)>;
 
   void OnHeadersFetched(UrlLoaderList::iterator iterator,
-                        base::OnceCallback<void(absl::optional<bool>)> callback,
+                        const std::string& ipfs_url,
                         scoped_refptr<net::HttpResponseHeaders> headers);
 
   raw_ptr<PrefService> pref_service_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   // List of requests are actively being sent.
   UrlLoaderList loaders_in_progress_;
+  // Callbacks waiting for the request of the url to finish.
+  base::flat_map<std::string, std::vector<CheckCallback>> pending_checks_;
+  // Results of finished checks, network failures are not cached.
+  base::LRUCache<std::string, bool> results_cache_;
 
   base::WeakPtrFactory<ContentTypeChecker> weak_ptr_factory_{this};
 };
@@ -13,6 +13,7 @@
 #include "base/json/json_reader.h"
 #include "base/json/values_util.h"
 #include "base/memory/raw_ptr.h"
+#include "base/run_loop.h"
 #include "base/test/bind.h"
 #include "base/time/time_override.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
@@ -25,6 +26,9 @@
 #include "components/prefs/testing_pref_service.h"
 #include "content/public/test/browser_task_environment.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "services/network/test/test_utils.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -1334,4 +1338,75 @@ TEST_F(BraveWalletPinServiceTest, Reset_Failed) {
   EXPECT_EQ(1u, service()->GetPinnedTokensCount());
 }
 
+TEST(ContentTypeCheckerTest, CoalescesAndCachesChecks) {
+  content::BrowserTaskEnvironment task_environment;
+  TestingPrefServiceSimple prefs;
+  IpfsService::RegisterProfilePrefs(prefs.registry());
+  network::TestURLLoaderFactory url_loader_factory;
+  size_t request_count = 0;
+  url_loader_factory.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        request_count++;
+        auto head = network::CreateURLResponseHead(net::HTTP_OK);
+        head->headers->SetHeader("Content-Type", "image/png");
+        url_loader_factory.AddResponse(request.url, std::move(head), "",
+                                       network::URLLoaderCompletionStatus());
+      }));
+  ContentTypeChecker checker(
+      &prefs, base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                  &url_loader_factory));
+
+  std::vector<absl::optional<bool>> results;
+  auto callback = base::BindLambdaForTesting(
+      [&results](absl::optional<bool> result) { results.push_back(result); });
+  checker.CheckContentTypeSupported(kMonkey1Url, callback);
+  checker.CheckContentTypeSupported(kMonkey1Url, callback);
+  checker.CheckContentTypeSupported(kMonkey1Url, callback);
+  checker.CheckContentTypeSupported(kMonkey2Url, callback);
+  base::RunLoop().RunUntilIdle();
+
+  EXPECT_EQ(request_count, 2u);
+  EXPECT_EQ(results,
+            std::vector<absl::optional<bool>>({true, true, true, true}));
+
+  // Finished checks are answered from the cache.
+  checker.CheckContentTypeSupported(kMonkey2Url, callback);
+  EXPECT_EQ(request_count, 2u);
+  EXPECT_EQ(results.size(), 5u);
+  EXPECT_EQ(results.back(), true);
+}
+
+TEST(ContentTypeCheckerTest, DoesNotCacheErrorResponses) {
+  content::BrowserTaskEnvironment task_environment;
+  TestingPrefServiceSimple prefs;
+  IpfsService::RegisterProfilePrefs(prefs.registry());
+  network::TestURLLoaderFactory url_loader_factory;
+  size_t request_count = 0;
+  url_loader_factory.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        request_count++;
+        auto head = network::CreateURLResponseHead(net::HTTP_NOT_FOUND);
+        head->headers->SetHeader("Content-Type", "text/html");
+        url_loader_factory.AddResponse(request.url, std::move(head), "",
+                                       network::URLLoaderCompletionStatus());
+      }));
+  ContentTypeChecker checker(
+      &prefs, base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                  &url_loader_factory));
+
+  std::vector<absl::optional<bool>> results;
+  auto callback = base::BindLambdaForTesting(
+      [&results](absl::optional<bool> result) { results.push_back(result); });
+  checker.CheckContentTypeSupported(kMonkey1Url, callback);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(request_count, 1u);
+  ASSERT_EQ(results.size(), 1u);
+
+  // The url is fetched again.
+  checker.CheckContentTypeSupported(kMonkey1Url, callback);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(request_count, 2u);
+  EXPECT_EQ(results.size(), 2u);
+}
+
 }  // namespace brave_wallet
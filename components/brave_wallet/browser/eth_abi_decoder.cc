@@ -8,6 +8,7 @@
 #include <limits>
 #include <map>
 #include <tuple>
+#include <utility>
 
 #include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
@@ -39,7 +40,7 @@ namespace brave_wallet {
 namespace {
 // GetArgFromData extracts a 32-byte wide hex string from the calldata at the
 // specified offset. The parsed value is NOT prefixed by "0x".
-absl::optional<std::string> GetArgFromData(const std::vector<uint8_t>& input,
+absl::optional<std::string> GetArgFromData(base::span<const uint8_t> input,
                                            size_t offset) {
   if (offset > input.size() || input.size() - offset < 32)
     return absl::nullopt;
@@ -57,7 +58,7 @@ absl::optional<std::string> GetArgFromData(const std::vector<uint8_t>& input,
 //
 // The parsed address value is prefixed by "0x".
 absl::optional<std::string> GetAddressFromData(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t offset) {
   if (offset > input.size() || input.size() - offset < 32)
     return absl::nullopt;
@@ -71,18 +72,19 @@ absl::optional<std::string> GetAddressFromData(
 // Using this function to extract an integer outside the range of M is
 // considered an error.
 template <typename M>
-absl::optional<M> GetUintFromData(const std::vector<uint8_t>& input,
+absl::optional<M> GetUintFromData(base::span<const uint8_t> input,
                                   size_t offset) {
   static_assert(std::is_integral<M>::value, "M must be an integer type");
 
-  auto arg = GetArgFromData(input, offset);
-  if (!arg) {
+  if (offset > input.size() || input.size() - offset < 32)
     return absl::nullopt;
-  }
 
-  uint256_t value;
-  if (!HexValueToUint256("0x" + *arg, &value)) {
-    return absl::nullopt;
+  // Read the big-endian word directly rather than round-tripping it through
+  // a hex string.
+  uint256_t value = 0;
+  for (uint8_t byte : input.subspan(offset, 32)) {
+    value <<= uint256_t(8);
+    value |= byte;
   }
 
   // To prevent runtime errors, we make sure the value is within safe
@@ -98,7 +100,7 @@ absl::optional<M> GetUintFromData(const std::vector<uint8_t>& input,
 // hex string (without leading 0s), and prefixed by "0x".
 template <typename M>
 absl::optional<std::string> GetUintHexFromData(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t offset) {
   auto value = GetUintFromData<M>(input, offset);
   if (!value) {
@@ -112,7 +114,7 @@ absl::optional<std::string> GetUintHexFromData(
 // calldata at the specified offset.
 //
 // The parsed bool value is serialized as "true" or "false" strings.
-absl::optional<std::string> GetBoolFromData(const std::vector<uint8_t>& input,
+absl::optional<std::string> GetBoolFromData(base::span<const uint8_t> input,
                                             size_t offset) {
   auto value = GetUintFromData<uint8_t>(input, offset);
   if (!value)
@@ -134,7 +136,7 @@ absl::optional<std::string> GetBoolFromData(const std::vector<uint8_t>& input,
 //
 // The parsed bytearray is serialized as a hex string prefixed by "0x".
 absl::optional<std::string> GetBytesHexFromData(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t offset) {
   auto pointer = GetUintFromData<size_t>(input, offset);
   if (!pointer)
@@ -156,7 +158,7 @@ absl::optional<std::string> GetBytesHexFromData(
 //
 // The parsed data is joined together into a hex string prefixed by "0x".
 absl::optional<std::string> GetAddressArrayFromData(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t offset) {
   auto pointer = GetUintFromData<size_t>(input, offset);
   if (!pointer)
@@ -239,11 +241,13 @@ absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
 absl::optional<std::tuple<std::vector<std::string>,   // params
                           std::vector<std::string>>>  // args
 ABIDecode(const std::vector<std::string>& types,
-          const std::vector<uint8_t>& data) {
+          base::span<const uint8_t> data) {
   size_t offset = 0;
   size_t calldata_tail = 0;
   std::vector<std::string> params;
   std::vector<std::string> args;
+  params.reserve(types.size());
+  args.reserve(types.size());
 
   for (const auto& type : types) {
     absl::optional<std::string> value;
@@ -290,13 +294,13 @@ ABIDecode(const std::vector<std::string>& types,
 
     offset += 32;
 
-    args.push_back(*value);
+    args.push_back(std::move(*value));
     params.push_back(type);
   }
 
   // Extra calldata bytes are ignored.
 
-  return std::make_tuple(params, args);
+  return std::make_tuple(std::move(params), std::move(args));
 }
 
 }  // namespace brave_wallet
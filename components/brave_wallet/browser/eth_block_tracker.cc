@@ -22,13 +22,9 @@ EthBlockTracker::~EthBlockTracker() = default;
 
 void EthBlockTracker::Start(const std::string& chain_id,
                             base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&EthBlockTracker::GetBlockNumber,
-                          weak_factory_.GetWeakPtr(), chain_id));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&EthBlockTracker::GetBlockNumber,
+                                   weak_factory_.GetWeakPtr(), chain_id));
 }
 
 void EthBlockTracker::AddObserver(EthBlockTracker::Observer* observer) {
@@ -73,7 +69,9 @@ void EthBlockTracker::OnGetBlockNumber(const std::string& chain_id,
                                        mojom::ProviderError error,
                                        const std::string& error_message) {
   if (error == mojom::ProviderError::kSuccess) {
-    if (GetCurrentBlock(chain_id) != block_num) {
+    const bool has_new_block = GetCurrentBlock(chain_id) != block_num;
+    OnPollResult(chain_id, has_new_block);
+    if (has_new_block) {
       current_block_map_[chain_id] = block_num;
       for (auto& observer : observers_) {
         observer.OnNewBlock(chain_id, block_num);
@@ -7,9 +7,11 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/scoped_observation.h"
 #include "base/test/bind.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
@@ -304,4 +306,117 @@ TEST_F(EthBlockTrackerUnitTest, GetBlockNumberRequestTimeout) {
   }
 }
 
+TEST_F(EthBlockTrackerUnitTest, IdleBackoff) {
+  EthBlockTracker tracker(json_rpc_service_.get());
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(request.url.spec(),
+                                        GetResponseString());
+      }));
+  response_block_num_ = 1;
+
+  tracker.Start(mojom::kMainnetChainId, base::Seconds(2));
+  // First poll sees a new block, the next four see the same one.
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(tracker.GetCurrentIntervalForTesting(mojom::kMainnetChainId),
+            base::Seconds(2));
+
+  // Fifth idle poll starts doubling the interval, capped at 4x.
+  task_environment_.FastForwardBy(base::Seconds(2));
+  EXPECT_EQ(tracker.GetCurrentIntervalForTesting(mojom::kMainnetChainId),
+            base::Seconds(4));
+  task_environment_.FastForwardBy(base::Seconds(4));
+  EXPECT_EQ(tracker.GetCurrentIntervalForTesting(mojom::kMainnetChainId),
+            base::Seconds(8));
+  task_environment_.FastForwardBy(base::Seconds(8));
+  EXPECT_EQ(tracker.GetCurrentIntervalForTesting(mojom::kMainnetChainId),
+            base::Seconds(8));
+
+  // A new block restores the requested interval.
+  response_block_num_ = 2;
+  task_environment_.FastForwardBy(base::Seconds(8));
+  EXPECT_EQ(tracker.GetCurrentIntervalForTesting(mojom::kMainnetChainId),
+            base::Seconds(2));
+}
+
+TEST_F(EthBlockTrackerUnitTest, AlignedWakeUps) {
+  EthBlockTracker tracker(json_rpc_service_.get());
+  std::vector<base::TimeTicks> request_times;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        request_times.push_back(base::TimeTicks::Now());
+      }));
+
+  const base::TimeTicks start = base::TimeTicks::Now();
+  tracker.Start(mojom::kMainnetChainId, base::Seconds(10));
+  task_environment_.FastForwardBy(base::Milliseconds(500));
+  tracker.Start(mojom::kGoerliChainId, base::Seconds(10));
+
+  // Goerli is due 500ms after mainnet, so both are polled together.
+  task_environment_.FastForwardBy(base::Seconds(10));
+  ASSERT_EQ(request_times.size(), 2u);
+  EXPECT_EQ(request_times[0], start + base::Seconds(10));
+  EXPECT_EQ(request_times[1], start + base::Seconds(10));
+}
+
+TEST_F(EthBlockTrackerUnitTest, AlignedWakeUpsAcrossTrackers) {
+  EthBlockTracker tracker1(json_rpc_service_.get());
+  EthBlockTracker tracker2(json_rpc_service_.get());
+  std::vector<base::TimeTicks> request_times;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        request_times.push_back(base::TimeTicks::Now());
+      }));
+
+  const base::TimeTicks start = base::TimeTicks::Now();
+  tracker1.Start(mojom::kMainnetChainId, base::Seconds(10));
+  task_environment_.FastForwardBy(base::Milliseconds(500));
+  tracker2.Start(mojom::kMainnetChainId, base::Seconds(10));
+  EXPECT_TRUE(tracker1.IsRunning(mojom::kMainnetChainId));
+  EXPECT_TRUE(tracker2.IsRunning(mojom::kMainnetChainId));
+
+  // Trackers of the same JsonRpcService share one timer.
+  task_environment_.FastForwardBy(base::Seconds(10));
+  ASSERT_EQ(request_times.size(), 2u);
+  EXPECT_EQ(request_times[0], start + base::Seconds(10));
+  EXPECT_EQ(request_times[1], start + base::Seconds(10));
+
+  // Stopping one tracker leaves the chains of the other one running.
+  tracker1.Stop();
+  EXPECT_FALSE(tracker1.IsRunning(mojom::kMainnetChainId));
+  EXPECT_TRUE(tracker2.IsRunning(mojom::kMainnetChainId));
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(request_times.size(), 3u);
+}
+
+TEST_F(EthBlockTrackerUnitTest, WakeUpsPerHourMetric) {
+  base::HistogramTester histogram_tester;
+  EthBlockTracker tracker(json_rpc_service_.get());
+  url_loader_factory_.SetInterceptor(
+      base::BindRepeating([](const network::ResourceRequest& request) {}));
+
+  tracker.Start(mojom::kMainnetChainId, base::Minutes(25));
+  task_environment_.FastForwardBy(base::Minutes(59));
+  histogram_tester.ExpectTotalCount("Brave.Wallet.BlockTrackerWakeUpsPerHour",
+                                    0);
+
+  // Wake-ups at 25 and 50 minutes are reported once the hour is over, even
+  // though the tracker doesn't wake up at that time.
+  task_environment_.FastForwardBy(base::Minutes(1));
+  histogram_tester.ExpectUniqueSample("Brave.Wallet.BlockTrackerWakeUpsPerHour",
+                                      2, 1);
+
+  // Wake-ups at 75 and 100 minutes.
+  task_environment_.FastForwardBy(base::Hours(1));
+  histogram_tester.ExpectUniqueSample("Brave.Wallet.BlockTrackerWakeUpsPerHour",
+                                      2, 2);
+
+  // Nothing is reported while no chain is polled.
+  tracker.Stop();
+  task_environment_.FastForwardBy(base::Hours(2));
+  histogram_tester.ExpectTotalCount("Brave.Wallet.BlockTrackerWakeUpsPerHour",
+                                    2);
+}
+
 }  // namespace brave_wallet
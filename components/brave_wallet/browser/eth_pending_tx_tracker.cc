@@ -5,8 +5,10 @@
 
 #include "brave/components/brave_wallet/browser/eth_pending_tx_tracker.h"
 
+#include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "base/containers/contains.h"
 #include "base/logging.h"
@@ -45,8 +47,19 @@ bool EthPendingTxTracker::UpdatePendingTransactions(
       pending_transactions.end(),
       std::make_move_iterator(signed_transactions.begin()),
       std::make_move_iterator(signed_transactions.end()));
+  // Confirmed transactions are loaded once per chain for the whole batch
+  // rather than once per pending transaction.
+  std::map<std::string, std::vector<std::unique_ptr<TxMeta>>>
+      confirmed_transactions;
   for (const auto& pending_transaction : pending_transactions) {
-    if (IsNonceTaken(static_cast<const EthTxMeta&>(*pending_transaction))) {
+    const auto& tx_chain_id = pending_transaction->chain_id();
+    if (!base::Contains(confirmed_transactions, tx_chain_id)) {
+      confirmed_transactions[tx_chain_id] =
+          tx_state_manager_->GetTransactionsByStatus(
+              tx_chain_id, mojom::TransactionStatus::Confirmed, absl::nullopt);
+    }
+    if (IsNonceTaken(static_cast<const EthTxMeta&>(*pending_transaction),
+                     confirmed_transactions[tx_chain_id])) {
       DropTransaction(pending_transaction.get());
       continue;
     }
@@ -114,8 +127,15 @@ void EthPendingTxTracker::OnSendRawTransaction(
     const std::string& error_message) {}
 
 bool EthPendingTxTracker::IsNonceTaken(const EthTxMeta& meta) {
-  auto confirmed_transactions = tx_state_manager_->GetTransactionsByStatus(
-      meta.chain_id(), mojom::TransactionStatus::Confirmed, absl::nullopt);
+  return IsNonceTaken(
+      meta, tx_state_manager_->GetTransactionsByStatus(
+                meta.chain_id(), mojom::TransactionStatus::Confirmed,
+                absl::nullopt));
+}
+
+bool EthPendingTxTracker::IsNonceTaken(
+    const EthTxMeta& meta,
+    const std::vector<std::unique_ptr<TxMeta>>& confirmed_transactions) {
   for (const auto& confirmed_transaction : confirmed_transactions) {
     auto* eth_confirmed_transaction =
         static_cast<EthTxMeta*>(confirmed_transaction.get());
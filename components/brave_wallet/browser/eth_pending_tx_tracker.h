@@ -7,8 +7,10 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_PENDING_TX_TRACKER_H_
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/gtest_prod_util.h"
@@ -57,6 +59,9 @@ class EthPendingTxTracker {
                             const std::string& error_message);
 
   bool IsNonceTaken(const EthTxMeta&);
+  bool IsNonceTaken(
+      const EthTxMeta&,
+      const std::vector<std::unique_ptr<TxMeta>>& confirmed_transactions);
   bool ShouldTxDropped(const EthTxMeta&);
 
   void DropTransaction(TxMeta*);
@@ -213,7 +213,10 @@ DecodeGetERC20TokenBalancesEthCallResponse(const std::string& data) {
     return absl::nullopt;
   }
 
-  auto decoded = eth_abi::ExtractBoolBytesArrayFromTuple(response_bytes, 0);
+  // Balances are hex encoded straight from views into the response, without
+  // an intermediate copy of every returned bytes value.
+  auto decoded =
+      eth_abi::ExtractBoolBytesArrayFromTupleAsSpans(response_bytes, 0);
   if (decoded == absl::nullopt) {
     return absl::nullopt;
   }
@@ -221,6 +224,7 @@ DecodeGetERC20TokenBalancesEthCallResponse(const std::string& data) {
   // Loop through the decoded values, and add the balance
   // if successful, otherwise null optional
   std::vector<absl::optional<std::string>> balances;
+  balances.reserve(decoded->size());
   for (const auto& tuple : *decoded) {
     if (tuple.first) {
       // Convert bytes to hex
@@ -21,14 +21,10 @@ FilBlockTracker::~FilBlockTracker() = default;
 
 void FilBlockTracker::Start(const std::string& chain_id,
                             base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id,
-                          base::NullCallback()));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
+                                   weak_ptr_factory_.GetWeakPtr(), chain_id,
+                                   base::NullCallback()));
 }
 
 void FilBlockTracker::GetFilBlockHeight(const std::string& chain_id,
@@ -60,8 +56,10 @@ void FilBlockTracker::OnGetFilBlockHeight(const std::string& chain_id,
     return;
   }
   if (GetLatestHeight(chain_id) == latest_height) {
+    OnPollResult(chain_id, false);
     return;
   }
+  OnPollResult(chain_id, true);
   latest_height_map_[chain_id] = latest_height;
   for (auto& observer : observers_)
     observer.OnLatestHeightUpdated(chain_id, latest_height);
@@ -19,6 +19,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_threadsafe.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
+#include "brave/components/brave_wallet/browser/block_tracker_scheduler.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/ens_resolver_task.h"
 #include "brave/components/brave_wallet/browser/nft_metadata_fetcher.h"
@@ -490,6 +491,12 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
       const SolanaAddress& pubkey,
       GetSolanaTokenAccountsByOwnerCallback callback);
 
+  // Shared by the block trackers of all coins, so that their polls are
+  // aligned.
+  BlockTrackerScheduler* block_tracker_scheduler() {
+    return &block_tracker_scheduler_;
+  }
+
  private:
   void FireNetworkChanged(mojom::CoinType coin,
                           const std::string& chain_id,
@@ -680,6 +687,7 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   const raw_ptr<PrefService> prefs_ = nullptr;
   const raw_ptr<PrefService> local_state_prefs_ = nullptr;
   std::unique_ptr<NftMetadataFetcher> nft_metadata_fetcher_;
+  BlockTrackerScheduler block_tracker_scheduler_;
   base::WeakPtrFactory<JsonRpcService> weak_ptr_factory_;
 };
 
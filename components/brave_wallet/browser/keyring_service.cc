@@ -12,11 +12,13 @@
 #include "base/check_op.h"
 #include "base/command_line.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/notreached.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/value_iterators.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/bitcoin_keyring.h"
@@ -122,6 +124,7 @@ const size_t kNonceSize = 12;
 const int kPbkdf2IterationsLegacy = 100000;
 const int kPbkdf2Iterations = 310000;
 const int kPbkdf2KeySize = 256;
+const char kUnlockDurationHistogramName[] = "Brave.Wallet.UnlockDuration";
 const char kPasswordEncryptorSalt[] = "password_encryptor_salt";
 const char kPasswordEncryptorNonce[] = "password_encryptor_nonce";
 const char kEncryptedMnemonic[] = "encrypted_mnemonic";
@@ -215,6 +218,32 @@ int GetPbkdf2Iterations() {
       kPbkdf2Iterations);
 }
 
+// Keyrings which might still be encrypted with kPbkdf2IterationsLegacy.
+const char* const kPbkdf2MigrationKeyringIds[] = {
+    mojom::kDefaultKeyringId, mojom::kFilecoinKeyringId,
+    mojom::kFilecoinTestnetKeyringId, mojom::kSolanaKeyringId};
+
+std::vector<uint8_t> CreateSalt() {
+  std::vector<uint8_t> salt(kSaltSize);
+  crypto::RandBytes(salt);
+  return salt;
+}
+
+// Returns the salt of legacy encrypted data which needs migration for
+// |keyring_id|, if any.
+absl::optional<std::vector<uint8_t>> GetLegacySaltForMigration(
+    const PrefService& profile_prefs,
+    const std::string& keyring_id) {
+  if (!KeyringService::GetPrefInBytesForKeyring(
+          profile_prefs, kEncryptedMnemonic, keyring_id) ||
+      !KeyringService::GetPrefInBytesForKeyring(
+          profile_prefs, kPasswordEncryptorNonce, keyring_id)) {
+    return absl::nullopt;
+  }
+  return KeyringService::GetPrefInBytesForKeyring(
+      profile_prefs, kPasswordEncryptorSalt, keyring_id);
+}
+
 const base::Value::List* GetPrefForKeyringList(const PrefService& profile_prefs,
                                                const std::string& key,
                                                const std::string& id) {
@@ -483,6 +512,13 @@ KeyringService::~KeyringService() {
   auto_lock_timer_.reset();
 }
 
+KeyringService::UnlockEncryptors::UnlockEncryptors() = default;
+KeyringService::UnlockEncryptors::UnlockEncryptors(UnlockEncryptors&&) =
+    default;
+KeyringService::UnlockEncryptors& KeyringService::UnlockEncryptors::operator=(
+    UnlockEncryptors&&) = default;
+KeyringService::UnlockEncryptors::~UnlockEncryptors() = default;
+
 // static
 absl::optional<int>& KeyringService::GetPbkdf2IterationsForTesting() {
   static absl::optional<int> iterations;
@@ -599,11 +635,20 @@ void KeyringService::RequestUnlock() {
 
 HDKeyring* KeyringService::ResumeKeyring(const std::string& keyring_id,
                                          const std::string& password) {
-  DCHECK(profile_prefs_);
   if (!CreateEncryptorForKeyring(password, keyring_id)) {
     return nullptr;
   }
 
+  return ResumeKeyringInternal(keyring_id);
+}
+
+HDKeyring* KeyringService::ResumeKeyringInternal(
+    const std::string& keyring_id) {
+  DCHECK(profile_prefs_);
+  if (!encryptors_[keyring_id]) {
+    return nullptr;
+  }
+
   const std::string mnemonic = GetMnemonicForKeyringImpl(keyring_id);
   if (mnemonic.empty()) {
     return nullptr;
@@ -1782,6 +1827,7 @@ absl::optional<std::string> KeyringService::GetFilecoinSelectedAccount(
 }
 
 void KeyringService::Lock() {
+  CancelPendingUnlock();
   if (IsLockedSync()) {
     return;
   }
@@ -1809,14 +1855,130 @@ bool KeyringService::IsHardwareAccount(const std::string& keyring_id,
 
 void KeyringService::Unlock(const std::string& password,
                             KeyringService::UnlockCallback callback) {
-  if (!ResumeKeyring(mojom::kDefaultKeyringId, password)) {
+  if (password.empty()) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  // Only one unlock attempt at a time, the password might differ.
+  if (pending_unlock_callback_) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  // Added 08.08.2022
+  // Keyrings still encrypted with the legacy iteration count are re-encrypted
+  // with a fresh salt once their legacy data decrypts.
+  base::flat_map<std::string, std::vector<uint8_t>> legacy_salts;
+  base::flat_map<std::string, std::vector<uint8_t>> migration_salts;
+  if (!profile_prefs_->GetBoolean(kBraveWalletKeyringEncryptionKeysMigrated)) {
+    for (auto* keyring_id : kPbkdf2MigrationKeyringIds) {
+      if (auto legacy_salt =
+              GetLegacySaltForMigration(*profile_prefs_, keyring_id)) {
+        legacy_salts[keyring_id] = std::move(*legacy_salt);
+        migration_salts[keyring_id] = CreateSalt();
+      }
+    }
+  }
+
+  std::vector<std::string> keyring_ids = {mojom::kDefaultKeyringId};
+  if (IsFilecoinEnabled()) {
+    keyring_ids.push_back(mojom::kFilecoinKeyringId);
+    keyring_ids.push_back(mojom::kFilecoinTestnetKeyringId);
+  }
+  if (IsSolanaEnabled()) {
+    keyring_ids.push_back(mojom::kSolanaKeyringId);
+  }
+  if (IsBitcoinEnabled()) {
+    keyring_ids.push_back(mojom::kBitcoinKeyringId);
+  }
+
+  // Salts are read (and lazily created) here, key derivation itself runs on
+  // the thread pool so a high iteration count doesn't block this sequence.
+  base::flat_map<std::string, std::vector<uint8_t>> salts;
+  for (const auto& keyring_id : keyring_ids) {
+    auto it = migration_salts.find(keyring_id);
+    salts[keyring_id] = it != migration_salts.end()
+                            ? it->second
+                            : GetOrCreateSaltForKeyring(keyring_id);
+  }
+
+  pending_unlock_callback_ = std::move(callback);
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&KeyringService::DeriveUnlockEncryptors, password,
+                     std::move(salts), std::move(legacy_salts), migration_salts,
+                     GetPbkdf2Iterations()),
+      base::BindOnce(&KeyringService::OnUnlockEncryptorsDerived,
+                     unlock_weak_ptr_factory_.GetWeakPtr(),
+                     base::TimeTicks::Now(), migration_salts));
+}
+
+// static
+KeyringService::UnlockEncryptors KeyringService::DeriveUnlockEncryptors(
+    const std::string& password,
+    const base::flat_map<std::string, std::vector<uint8_t>>& salts,
+    const base::flat_map<std::string, std::vector<uint8_t>>& legacy_salts,
+    const base::flat_map<std::string, std::vector<uint8_t>>& migration_salts,
+    int iterations) {
+  UnlockEncryptors result;
+  result.encryptors = PasswordEncryptor::DeriveKeysFromPasswordUsingPbkdf2(
+      password, salts, iterations, kPbkdf2KeySize);
+  if (legacy_salts.empty()) {
+    return result;
+  }
+
+  result.legacy_encryptors =
+      PasswordEncryptor::DeriveKeysFromPasswordUsingPbkdf2(
+          password, legacy_salts, kPbkdf2IterationsLegacy, kPbkdf2KeySize);
+  base::flat_map<std::string, std::vector<uint8_t>> other_migration_salts;
+  for (const auto& [keyring_id, salt] : migration_salts) {
+    if (!salts.contains(keyring_id)) {
+      other_migration_salts[keyring_id] = salt;
+    }
+  }
+  result.migrated_encryptors =
+      PasswordEncryptor::DeriveKeysFromPasswordUsingPbkdf2(
+          password, other_migration_salts, iterations, kPbkdf2KeySize);
+  return result;
+}
+
+void KeyringService::OnUnlockEncryptorsDerived(
+    base::TimeTicks start_time,
+    base::flat_map<std::string, std::vector<uint8_t>> migration_salts,
+    UnlockEncryptors unlock_encryptors) {
+  DCHECK(pending_unlock_callback_);
+  auto callback = std::move(pending_unlock_callback_);
+
+  auto& encryptors = unlock_encryptors.encryptors;
+  for (auto& [keyring_id, legacy_encryptor] :
+       unlock_encryptors.legacy_encryptors) {
+    auto it = encryptors.find(keyring_id);
+    PasswordEncryptor* encryptor =
+        it != encryptors.end()
+            ? it->second.get()
+            : unlock_encryptors.migrated_encryptors[keyring_id].get();
+    if (!legacy_encryptor || !encryptor ||
+        !MigratePBKDF2IterationsForKeyring(keyring_id, *legacy_encryptor,
+                                           *encryptor,
+                                           migration_salts[keyring_id])) {
+      // The key belongs to a salt which wasn't stored.
+      encryptors.erase(keyring_id);
+    }
+  }
+
+  for (auto& [keyring_id, encryptor] : encryptors) {
+    encryptors_[keyring_id] = std::move(encryptor);
+  }
+
+  if (!ResumeKeyringInternal(mojom::kDefaultKeyringId)) {
     encryptors_.erase(mojom::kDefaultKeyringId);
     std::move(callback).Run(false);
     return;
   }
 
   if (IsFilecoinEnabled()) {
-    if (!ResumeKeyring(mojom::kFilecoinKeyringId, password)) {
+    if (!ResumeKeyringInternal(mojom::kFilecoinKeyringId)) {
       // If Filecoin keyring doesnt exist we keep encryptor pre-created
       // to be able to lazily create keyring later
       if (IsKeyringExist(mojom::kFilecoinKeyringId)) {
@@ -1827,7 +1989,7 @@ void KeyringService::Unlock(const std::string& password,
       }
     }
 
-    if (!ResumeKeyring(mojom::kFilecoinTestnetKeyringId, password)) {
+    if (!ResumeKeyringInternal(mojom::kFilecoinTestnetKeyringId)) {
       if (IsKeyringExist(mojom::kFilecoinTestnetKeyringId)) {
         VLOG(1) << __func__ << " Unable to unlock filecoin testnet keyring";
         encryptors_.erase(mojom::kFilecoinTestnetKeyringId);
@@ -1837,7 +1999,7 @@ void KeyringService::Unlock(const std::string& password,
     }
   }
 
-  if (IsSolanaEnabled() && !ResumeKeyring(mojom::kSolanaKeyringId, password)) {
+  if (IsSolanaEnabled() && !ResumeKeyringInternal(mojom::kSolanaKeyringId)) {
     if (IsKeyringExist(mojom::kSolanaKeyringId)) {
       VLOG(1) << __func__ << " Unable to unlock Solana keyring";
       encryptors_.erase(mojom::kSolanaKeyringId);
@@ -1847,10 +2009,13 @@ void KeyringService::Unlock(const std::string& password,
   }
 
   if (IsBitcoinEnabled()) {
-    auto* bitcoin_keyring = ResumeKeyring(mojom::kBitcoinKeyringId, password);
+    auto* bitcoin_keyring = ResumeKeyringInternal(mojom::kBitcoinKeyringId);
     DCHECK(bitcoin_keyring);
   }
 
+  base::UmaHistogramTimes(kUnlockDurationHistogramName,
+                          base::TimeTicks::Now() - start_time);
+
   UpdateLastUnlockPref(local_state_);
   request_unlock_pending_ = false;
   for (const auto& observer : observers_) {
@@ -1861,6 +2026,13 @@ void KeyringService::Unlock(const std::string& password,
   std::move(callback).Run(true);
 }
 
+void KeyringService::CancelPendingUnlock() {
+  unlock_weak_ptr_factory_.InvalidateWeakPtrs();
+  if (pending_unlock_callback_) {
+    std::move(pending_unlock_callback_).Run(false);
+  }
+}
+
 void KeyringService::OnAutoLockFired() {
   Lock();
 }
@@ -1870,6 +2042,7 @@ void KeyringService::IsLocked(IsLockedCallback callback) {
 }
 
 void KeyringService::Reset(bool notify_observer) {
+  CancelPendingUnlock();
   StopAutoLockTimer();
   encryptors_.clear();
   keyrings_.clear();
@@ -1891,17 +2064,9 @@ void KeyringService::MaybeMigratePBKDF2Iterations(const std::string& password) {
   DCHECK(
       !profile_prefs_->HasPrefPath(kBraveWalletKeyringEncryptionKeysMigrated));
 
-  for (auto* keyring_id :
-       {mojom::kDefaultKeyringId, mojom::kFilecoinKeyringId,
-        mojom::kFilecoinTestnetKeyringId, mojom::kSolanaKeyringId}) {
-    auto legacy_encrypted_mnemonic = GetPrefInBytesForKeyring(
-        *profile_prefs_, kEncryptedMnemonic, keyring_id);
-    auto legacy_nonce = GetPrefInBytesForKeyring(
-        *profile_prefs_, kPasswordEncryptorNonce, keyring_id);
-    auto legacy_salt = GetPrefInBytesForKeyring(
-        *profile_prefs_, kPasswordEncryptorSalt, keyring_id);
-
-    if (!legacy_encrypted_mnemonic || !legacy_nonce || !legacy_salt) {
+  for (auto* keyring_id : kPbkdf2MigrationKeyringIds) {
+    auto legacy_salt = GetLegacySaltForMigration(*profile_prefs_, keyring_id);
+    if (!legacy_salt) {
       continue;
     }
 
@@ -1911,68 +2076,85 @@ void KeyringService::MaybeMigratePBKDF2Iterations(const std::string& password) {
       continue;
     }
 
-    auto mnemonic =
-        legacy_encryptor->Decrypt(*legacy_encrypted_mnemonic, *legacy_nonce);
-    if (!mnemonic) {
-      continue;
-    }
-
-    auto salt = GetOrCreateSaltForKeyring(keyring_id, /*force_create = */ true);
-
+    auto salt = CreateSalt();
     auto encryptor = PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
         password, salt, GetPbkdf2Iterations(), kPbkdf2KeySize);
     if (!encryptor) {
       continue;
     }
 
-    auto nonce =
-        GetOrCreateNonceForKeyring(keyring_id, /*force_create = */ true);
+    MigratePBKDF2IterationsForKeyring(keyring_id, *legacy_encryptor,
+                                      *encryptor, salt);
+  }
+}
 
-    SetPrefInBytesForKeyring(
-        profile_prefs_, kEncryptedMnemonic,
-        encryptor->Encrypt(base::make_span(*mnemonic), nonce), keyring_id);
+bool KeyringService::MigratePBKDF2IterationsForKeyring(
+    const std::string& keyring_id,
+    PasswordEncryptor& legacy_encryptor,
+    PasswordEncryptor& encryptor,
+    const std::vector<uint8_t>& salt) {
+  auto legacy_encrypted_mnemonic = GetPrefInBytesForKeyring(
+      *profile_prefs_, kEncryptedMnemonic, keyring_id);
+  auto legacy_nonce = GetPrefInBytesForKeyring(
+      *profile_prefs_, kPasswordEncryptorNonce, keyring_id);
+  if (!legacy_encrypted_mnemonic || !legacy_nonce) {
+    return false;
+  }
 
-    if (keyring_id == mojom::kDefaultKeyringId) {
-      profile_prefs_->SetBoolean(kBraveWalletKeyringEncryptionKeysMigrated,
-                                 true);
-    }
+  auto mnemonic =
+      legacy_encryptor.Decrypt(*legacy_encrypted_mnemonic, *legacy_nonce);
+  if (!mnemonic) {
+    return false;
+  }
+
+  SetPrefInBytesForKeyring(profile_prefs_, kPasswordEncryptorSalt, salt,
+                           keyring_id);
+  auto nonce = GetOrCreateNonceForKeyring(keyring_id, /*force_create = */ true);
 
-    const base::Value::List* imported_accounts_legacy =
-        GetPrefForKeyringList(*profile_prefs_, kImportedAccounts, keyring_id);
-    if (!imported_accounts_legacy) {
+  SetPrefInBytesForKeyring(
+      profile_prefs_, kEncryptedMnemonic,
+      encryptor.Encrypt(base::make_span(*mnemonic), nonce), keyring_id);
+
+  if (keyring_id == mojom::kDefaultKeyringId) {
+    profile_prefs_->SetBoolean(kBraveWalletKeyringEncryptionKeysMigrated, true);
+  }
+
+  const base::Value::List* imported_accounts_legacy =
+      GetPrefForKeyringList(*profile_prefs_, kImportedAccounts, keyring_id);
+  if (!imported_accounts_legacy) {
+    return true;
+  }
+  base::Value::List imported_accounts = imported_accounts_legacy->Clone();
+  for (auto& imported_account : imported_accounts) {
+    if (!imported_account.is_dict()) {
       continue;
     }
-    base::Value::List imported_accounts = imported_accounts_legacy->Clone();
-    for (auto& imported_account : imported_accounts) {
-      if (!imported_account.is_dict()) {
-        continue;
-      }
-
-      const std::string* legacy_encrypted_private_key =
-          imported_account.GetDict().FindString(kEncryptedPrivateKey);
-      if (!legacy_encrypted_private_key) {
-        continue;
-      }
 
-      auto legacy_private_key_decoded =
-          base::Base64Decode(*legacy_encrypted_private_key);
-      if (!legacy_private_key_decoded) {
-        continue;
-      }
+    const std::string* legacy_encrypted_private_key =
+        imported_account.GetDict().FindString(kEncryptedPrivateKey);
+    if (!legacy_encrypted_private_key) {
+      continue;
+    }
 
-      auto private_key = legacy_encryptor->Decrypt(
-          base::make_span(*legacy_private_key_decoded), *legacy_nonce);
-      if (!private_key) {
-        continue;
-      }
+    auto legacy_private_key_decoded =
+        base::Base64Decode(*legacy_encrypted_private_key);
+    if (!legacy_private_key_decoded) {
+      continue;
+    }
 
-      imported_account.GetDict().Set(
-          kEncryptedPrivateKey,
-          base::Base64Encode(encryptor->Encrypt(*private_key, nonce)));
+    auto private_key = legacy_encryptor.Decrypt(
+        base::make_span(*legacy_private_key_decoded), *legacy_nonce);
+    if (!private_key) {
+      continue;
     }
-    SetPrefForKeyring(profile_prefs_, kImportedAccounts,
-                      base::Value(std::move(imported_accounts)), keyring_id);
+
+    imported_account.GetDict().Set(
+        kEncryptedPrivateKey,
+        base::Base64Encode(encryptor.Encrypt(*private_key, nonce)));
   }
+  SetPrefForKeyring(profile_prefs_, kImportedAccounts,
+                    base::Value(std::move(imported_accounts)), keyring_id);
+  return true;
 }
 
 void KeyringService::StopAutoLockTimer() {
@@ -2043,8 +2225,7 @@ std::vector<uint8_t> KeyringService::GetOrCreateSaltForKeyring(
     }
   }
 
-  std::vector<uint8_t> salt(kSaltSize);
-  crypto::RandBytes(salt);
+  std::vector<uint8_t> salt = CreateSalt();
   SetPrefInBytesForKeyring(profile_prefs_, kPasswordEncryptorSalt, salt, id);
   return salt;
 }
@@ -13,6 +13,7 @@
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/hd_keyring.h"
 #include "brave/components/brave_wallet/browser/password_encryptor.h"
@@ -237,6 +238,25 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
       uint32_t change_index);
 
  private:
+  // Keys derived on the thread pool for a single Unlock call, all keyed by
+  // keyring id.
+  struct UnlockEncryptors {
+    UnlockEncryptors();
+    UnlockEncryptors(UnlockEncryptors&&);
+    UnlockEncryptors& operator=(UnlockEncryptors&&);
+    ~UnlockEncryptors();
+
+    // Derived from the current salts of keyrings to unlock.
+    base::flat_map<std::string, std::unique_ptr<PasswordEncryptor>> encryptors;
+    // For keyrings still encrypted with the legacy iteration count.
+    base::flat_map<std::string, std::unique_ptr<PasswordEncryptor>>
+        legacy_encryptors;
+    // Keys for the migration salts of keyrings which are not being unlocked,
+    // the others have theirs in |encryptors|.
+    base::flat_map<std::string, std::unique_ptr<PasswordEncryptor>>
+        migrated_encryptors;
+  };
+
   FRIEND_TEST_ALL_PREFIXES(KeyringServiceUnitTest, GetOrCreateNonceForKeyring);
   FRIEND_TEST_ALL_PREFIXES(KeyringServiceUnitTest, GetOrCreateSaltForKeyring);
   FRIEND_TEST_ALL_PREFIXES(KeyringServiceUnitTest, CreateEncryptorForKeyring);
@@ -355,8 +375,29 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   // It's used to reconstruct same default keyring between browser relaunch
   HDKeyring* ResumeKeyring(const std::string& keyring_id,
                            const std::string& password);
+  // Same as above but uses the encryptor already present in |encryptors_|.
+  HDKeyring* ResumeKeyringInternal(const std::string& keyring_id);
+  static UnlockEncryptors DeriveUnlockEncryptors(
+      const std::string& password,
+      const base::flat_map<std::string, std::vector<uint8_t>>& salts,
+      const base::flat_map<std::string, std::vector<uint8_t>>& legacy_salts,
+      const base::flat_map<std::string, std::vector<uint8_t>>& migration_salts,
+      int iterations);
+  void OnUnlockEncryptorsDerived(
+      base::TimeTicks start_time,
+      base::flat_map<std::string, std::vector<uint8_t>> migration_salts,
+      UnlockEncryptors unlock_encryptors);
+  // Drops the reply of an in-flight Unlock call and fails its callback.
+  void CancelPendingUnlock();
 
   void MaybeMigratePBKDF2Iterations(const std::string& password);
+  // Re-encrypts |keyring_id| data encrypted with |legacy_encryptor| using
+  // |encryptor|, which must be derived from |salt|. Returns false if the legacy
+  // data couldn't be decrypted.
+  bool MigratePBKDF2IterationsForKeyring(const std::string& keyring_id,
+                                         PasswordEncryptor& legacy_encryptor,
+                                         PasswordEncryptor& encryptor,
+                                         const std::vector<uint8_t>& salt);
 
   void NotifyAccountsChanged();
   void NotifyAccountsAdded(mojom::CoinType coin,
@@ -392,11 +433,15 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   raw_ptr<PrefService> profile_prefs_ = nullptr;
   raw_ptr<PrefService> local_state_ = nullptr;
   bool request_unlock_pending_ = false;
+  // Set while keys for an Unlock call are derived on the thread pool.
+  UnlockCallback pending_unlock_callback_;
 
   mojo::RemoteSet<mojom::KeyringServiceObserver> observers_;
   mojo::ReceiverSet<mojom::KeyringService> receivers_;
 
   base::WeakPtrFactory<KeyringService> discovery_weak_factory_{this};
+  // Invalidated by Lock() and Reset() so a late Unlock reply is dropped.
+  base::WeakPtrFactory<KeyringService> unlock_weak_ptr_factory_{this};
 
   KeyringService(const KeyringService&) = delete;
   KeyringService& operator=(const KeyringService&) = delete;
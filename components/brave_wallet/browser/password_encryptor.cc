@@ -5,8 +5,10 @@
 
 #include "brave/components/brave_wallet/browser/password_encryptor.h"
 
+#include <map>
 #include <utility>
 
+#include "base/memory/ptr_util.h"
 #include "brave/components/brave_wallet/common/mem_utils.h"
 #include "crypto/aead.h"
 #include "crypto/openssl_util.h"
@@ -43,6 +45,32 @@ PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
   return rv == 1 ? std::move(encryptor) : nullptr;
 }
 
+// static
+base::flat_map<std::string, std::unique_ptr<PasswordEncryptor>>
+PasswordEncryptor::DeriveKeysFromPasswordUsingPbkdf2(
+    const std::string& password,
+    const base::flat_map<std::string, std::vector<uint8_t>>& salts,
+    size_t iterations,
+    size_t key_size_in_bits) {
+  base::flat_map<std::string, std::unique_ptr<PasswordEncryptor>> result;
+  std::map<std::vector<uint8_t>, std::unique_ptr<PasswordEncryptor>> by_salt;
+  for (const auto& [id, salt] : salts) {
+    auto it = by_salt.find(salt);
+    if (it == by_salt.end()) {
+      it = by_salt
+               .emplace(salt, DeriveKeyFromPasswordUsingPbkdf2(
+                                  password, salt, iterations,
+                                  key_size_in_bits))
+               .first;
+    }
+    if (!it->second) {
+      continue;
+    }
+    result[id] = base::WrapUnique(new PasswordEncryptor(it->second->key_));
+  }
+  return result;
+}
+
 std::vector<uint8_t> PasswordEncryptor::Encrypt(
     base::span<const uint8_t> plaintext,
     base::span<const uint8_t> nonce) {
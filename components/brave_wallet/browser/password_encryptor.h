@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/span.h"
 #include "base/gtest_prod_util.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -28,6 +29,17 @@ class PasswordEncryptor {
       size_t iterations,
       size_t key_size_in_bits);
 
+  // Derives one encryptor per entry of |salts|, keyed the same way. PBKDF2 is
+  // run once per distinct salt, entries sharing a salt get copies of the same
+  // key. Entries that fail to derive are left out of the result. This is
+  // CPU-heavy and is meant to be run on a background sequence.
+  static base::flat_map<std::string, std::unique_ptr<PasswordEncryptor>>
+  DeriveKeysFromPasswordUsingPbkdf2(
+      const std::string& password,
+      const base::flat_map<std::string, std::vector<uint8_t>>& salts,
+      size_t iterations,
+      size_t key_size_in_bits);
+
   std::vector<uint8_t> Encrypt(base::span<const uint8_t> plaintext,
                                base::span<const uint8_t> nonce);
 
@@ -34,6 +34,36 @@ TEST(PasswordEncryptorUnitTest, DeriveKeyFromPasswordUsingPbkdf2) {
             nullptr);
 }
 
+TEST(PasswordEncryptorUnitTest, DeriveKeysFromPasswordUsingPbkdf2) {
+  const std::vector<uint8_t> salt1(32, 0x01);
+  const std::vector<uint8_t> salt2(32, 0x02);
+  base::flat_map<std::string, std::vector<uint8_t>> salts = {
+      {"a", salt1}, {"b", salt2}, {"c", salt1}};
+
+  auto encryptors = PasswordEncryptor::DeriveKeysFromPasswordUsingPbkdf2(
+      "password", salts, 100, 256);
+  ASSERT_EQ(encryptors.size(), 3u);
+
+  // Keys match the ones derived one by one.
+  const std::vector<uint8_t> nonce(12, 0xAB);
+  for (const auto& [id, salt] : salts) {
+    auto encryptor = PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
+        "password", salt, 100, 256);
+    auto ciphertext = encryptor->Encrypt(ToSpan("bravo"), nonce);
+    EXPECT_EQ("bravo", ToString(*encryptors[id]->Decrypt(ciphertext, nonce)));
+  }
+
+  // Same salt gives same key.
+  auto ciphertext = encryptors["a"]->Encrypt(ToSpan("bravo"), nonce);
+  EXPECT_TRUE(encryptors["c"]->Decrypt(ciphertext, nonce));
+  EXPECT_FALSE(encryptors["b"]->Decrypt(ciphertext, nonce));
+
+  // Failed derivations are left out.
+  EXPECT_TRUE(PasswordEncryptor::DeriveKeysFromPasswordUsingPbkdf2(
+                  "password", salts, 100, 64)
+                  .empty());
+}
+
 TEST(PasswordEncryptorUnitTest, EncryptAndDecrypt) {
   std::unique_ptr<PasswordEncryptor> encryptor =
       PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
@@ -99,6 +99,30 @@ EthAddress ExtractAddress(Span32 address_encoded) {
   return EthAddress::FromBytes(address_encoded.subspan(12));
 }
 
+absl::optional<Span> ExtractBytesAsSpanFromTuple(Span data, size_t tuple_pos) {
+  // Head contains offset to bytes start.
+  auto head = ExtractHeadFromTuple(data, tuple_pos);
+  if (!head)
+    return absl::nullopt;
+
+  absl::optional<size_t> offset = BytesToSize(*head);
+  if (!offset || *offset > data.size())
+    return absl::nullopt;
+
+  return ExtractBytesAsSpan(data.subspan(*offset));
+}
+
+std::vector<std::pair<bool, std::vector<uint8_t>>> ToOwnedBoolBytesArray(
+    const std::vector<std::pair<bool, Span>>& spans) {
+  std::vector<std::pair<bool, std::vector<uint8_t>>> result;
+  result.reserve(spans.size());
+  for (const auto& [success, bytes] : spans) {
+    result.emplace_back(success,
+                        std::vector<uint8_t>(bytes.begin(), bytes.end()));
+  }
+  return result;
+}
+
 }  // namespace
 
 std::pair<Span, Span> ExtractFunctionSelectorAndArgsFromCall(Span data) {
@@ -133,7 +157,7 @@ EthAddress ExtractAddressFromTuple(Span data, size_t tuple_pos) {
   return ExtractAddress(*address_head);
 }
 
-absl::optional<std::vector<uint8_t>> ExtractBytes(Span bytes_encoded) {
+absl::optional<Span> ExtractBytesAsSpan(Span bytes_encoded) {
   // uint256 size followed by padded bytes.
   auto bytes_len_row = ExtractRow(bytes_encoded, 0);
   if (!bytes_len_row)
@@ -142,7 +166,7 @@ absl::optional<std::vector<uint8_t>> ExtractBytes(Span bytes_encoded) {
   if (!bytes_len)
     return absl::nullopt;
   if (*bytes_len == 0)
-    return std::vector<uint8_t>();
+    return Span();
 
   Span padded_bytes_data =
       ExtractRows(bytes_encoded, 1, PaddedRowCount(*bytes_len));
@@ -150,8 +174,14 @@ absl::optional<std::vector<uint8_t>> ExtractBytes(Span bytes_encoded) {
     return absl::nullopt;
   if (!CheckPadding(padded_bytes_data, *bytes_len))
     return absl::nullopt;
-  Span bytes_result = padded_bytes_data.subspan(0, *bytes_len);
-  return std::vector<uint8_t>{bytes_result.begin(), bytes_result.end()};
+  return padded_bytes_data.subspan(0, *bytes_len);
+}
+
+absl::optional<std::vector<uint8_t>> ExtractBytes(Span bytes_encoded) {
+  auto bytes_result = ExtractBytesAsSpan(bytes_encoded);
+  if (!bytes_result)
+    return absl::nullopt;
+  return std::vector<uint8_t>{bytes_result->begin(), bytes_result->end()};
 }
 
 absl::optional<std::string> ExtractString(Span string_encoded) {
@@ -208,23 +238,35 @@ absl::optional<std::vector<std::string>> ExtractStringArray(Span string_array) {
   return result;
 }
 
-absl::optional<std::pair<bool, std::vector<uint8_t>>> ExtractBoolAndBytes(
-    Span data) {
+absl::optional<std::pair<bool, Span>> ExtractBoolAndBytesAsSpan(Span data) {
   auto bool_row = ExtractRow(data, 0);
   if (!bool_row) {
     return absl::nullopt;
   }
 
-  auto bytes = ExtractBytesFromTuple(data, 1);
+  auto bytes = ExtractBytesAsSpanFromTuple(data, 1);
   if (!bytes) {
     return absl::nullopt;
   }
 
-  return std::make_pair(BytesToBool(*bool_row), std::move(*bytes));
+  return std::make_pair(BytesToBool(*bool_row), *bytes);
 }
 
-absl::optional<std::vector<std::pair<bool, std::vector<uint8_t>>>>
-ExtractBoolBytesArrayFromTuple(Span data, size_t tuple_pos) {
+absl::optional<std::pair<bool, std::vector<uint8_t>>> ExtractBoolAndBytes(
+    Span data) {
+  auto bool_bytes = ExtractBoolAndBytesAsSpan(data);
+  if (!bool_bytes) {
+    return absl::nullopt;
+  }
+
+  return std::make_pair(
+      bool_bytes->first,
+      std::vector<uint8_t>(bool_bytes->second.begin(),
+                           bool_bytes->second.end()));
+}
+
+absl::optional<std::vector<std::pair<bool, Span>>>
+ExtractBoolBytesArrayFromTupleAsSpans(Span data, size_t tuple_pos) {
   // Head row contains offset to (bool, bytes)[] start.
   auto array_head = ExtractHeadFromTuple(data, tuple_pos);
   if (!array_head) {
@@ -237,11 +279,11 @@ ExtractBoolBytesArrayFromTuple(Span data, size_t tuple_pos) {
   }
 
   Span array_data = data.subspan(*array_offset);
-  return ExtractBoolBytesArray(array_data);
+  return ExtractBoolBytesArrayAsSpans(array_data);
 }
 
-absl::optional<std::vector<std::pair<bool, std::vector<uint8_t>>>>
-ExtractBoolBytesArray(Span tuple_array) {
+absl::optional<std::vector<std::pair<bool, Span>>> ExtractBoolBytesArrayAsSpans(
+    Span tuple_array) {
   // Array is stored as size row and tuple of that size.
   auto [tuple_size, tuple_header] = ExtractArrayInfo(tuple_array);
   if (!tuple_size) {
@@ -252,10 +294,10 @@ ExtractBoolBytesArray(Span tuple_array) {
     return absl::nullopt;
   }
   if (*tuple_size == 0) {
-    return std::vector<std::pair<bool, std::vector<uint8_t>>>();
+    return std::vector<std::pair<bool, Span>>();
   }
 
-  std::vector<std::pair<bool, std::vector<uint8_t>>> result;
+  std::vector<std::pair<bool, Span>> result;
   result.reserve(*tuple_size);
   for (auto i = 0u; i < *tuple_size; ++i) {
     // Each tuple head row contains offset to encoded tuple.
@@ -270,16 +312,36 @@ ExtractBoolBytesArray(Span tuple_array) {
     }
 
     auto bool_bytes =
-        ExtractBoolAndBytes(tuple_header.subspan(*tuple_element_offset));
+        ExtractBoolAndBytesAsSpan(tuple_header.subspan(*tuple_element_offset));
     if (!bool_bytes) {
       return absl::nullopt;
     }
-    result.emplace_back(std::move(*bool_bytes));
+    result.push_back(*bool_bytes);
   }
 
   return result;
 }
 
+absl::optional<std::vector<std::pair<bool, std::vector<uint8_t>>>>
+ExtractBoolBytesArrayFromTuple(Span data, size_t tuple_pos) {
+  auto spans = ExtractBoolBytesArrayFromTupleAsSpans(data, tuple_pos);
+  if (!spans) {
+    return absl::nullopt;
+  }
+
+  return ToOwnedBoolBytesArray(*spans);
+}
+
+absl::optional<std::vector<std::pair<bool, std::vector<uint8_t>>>>
+ExtractBoolBytesArray(Span tuple_array) {
+  auto spans = ExtractBoolBytesArrayAsSpans(tuple_array);
+  if (!spans) {
+    return absl::nullopt;
+  }
+
+  return ToOwnedBoolBytesArray(*spans);
+}
+
 absl::optional<std::string> ExtractStringFromTuple(Span data,
                                                    size_t tuple_pos) {
   // Head contains offset to string start.
@@ -313,17 +375,10 @@ absl::optional<std::vector<std::string>> ExtractStringArrayFromTuple(
 
 absl::optional<std::vector<uint8_t>> ExtractBytesFromTuple(Span data,
                                                            size_t tuple_pos) {
-  // Head contains offset to bytes start.
-  auto head = ExtractHeadFromTuple(data, tuple_pos);
-  if (!head)
+  auto bytes = ExtractBytesAsSpanFromTuple(data, tuple_pos);
+  if (!bytes)
     return absl::nullopt;
-
-  absl::optional<size_t> offset = BytesToSize(*head);
-  if (!offset || *offset > data.size())
-    return absl::nullopt;
-
-  Span bytes = data.subspan(*offset);
-  return ExtractBytes(bytes);
+  return std::vector<uint8_t>{bytes->begin(), bytes->end()};
 }
 
 absl::optional<std::vector<uint8_t>>
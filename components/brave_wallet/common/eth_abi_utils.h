@@ -46,6 +46,15 @@ ExtractBoolBytesArray(Span string_array);
 absl::optional<std::vector<std::pair<bool, std::vector<uint8_t>>>>
 ExtractBoolBytesArrayFromTuple(Span data, size_t tuple_pos);
 
+// Zero-copy variants of the extractors above. Returned spans point into the
+// input buffer, so the input must outlive the result.
+absl::optional<Span> ExtractBytesAsSpan(Span bytes_encoded);
+absl::optional<std::pair<bool, Span>> ExtractBoolAndBytesAsSpan(Span data);
+absl::optional<std::vector<std::pair<bool, Span>>> ExtractBoolBytesArrayAsSpans(
+    Span tuple_array);
+absl::optional<std::vector<std::pair<bool, Span>>>
+ExtractBoolBytesArrayFromTupleAsSpans(Span data, size_t tuple_pos);
+
 absl::optional<std::vector<uint8_t>>
 ExtractFixedBytesFromTuple(Span data, size_t fixed_size, size_t tuple_pos);
 
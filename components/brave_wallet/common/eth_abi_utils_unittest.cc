@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/ranges/algorithm.h"
+#include "base/strings/stringprintf.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -683,6 +684,50 @@ TEST(EthAbiUtilsTest, ExtractBoolBytesTupleArray) {
             "0000000000000000000000000000000000000000000000000000000000000000");
 }
 
+TEST(EthAbiUtilsTest, ExtractBoolBytesArrayFromTupleAsSpans) {
+  // Same layout as a BalanceScanner response with many entries: a tuple
+  // holding one (bool, bytes)[] element.
+  const size_t kCount = 1000;
+  auto row = [](size_t value) {
+    std::string hex = base::StringPrintf("%zx", value);
+    return std::string(64 - hex.size(), '0') + hex;
+  };
+  std::string hex = row(0x20) + row(kCount);
+  // Each element is 4 rows: bool, bytes offset, bytes size, bytes data.
+  for (size_t i = 0; i < kCount; ++i) {
+    hex += row(kCount * 32 + i * 4 * 32);
+  }
+  for (size_t i = 0; i < kCount; ++i) {
+    hex += row(i % 2) + row(0x40) + row(0x20) + row(i);
+  }
+  const std::vector<uint8_t> bytes = ToBytes(hex);
+
+  auto result = ExtractBoolBytesArrayFromTupleAsSpans(bytes, 0);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result->size(), kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ((*result)[i].first, i % 2 == 1);
+    ASSERT_EQ((*result)[i].second.size(), 32u);
+    // Views point into the input buffer rather than into copies.
+    EXPECT_GE((*result)[i].second.data(), bytes.data());
+    EXPECT_LE((*result)[i].second.data() + 32, bytes.data() + bytes.size());
+    EXPECT_EQ(ToHex((*result)[i].second).substr(2), row(i));
+  }
+
+  // Owning variant decodes to the same values.
+  auto owned = ExtractBoolBytesArrayFromTuple(bytes, 0);
+  ASSERT_TRUE(owned);
+  ASSERT_EQ(owned->size(), kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ((*owned)[i].first, (*result)[i].first);
+    EXPECT_TRUE(base::ranges::equal((*owned)[i].second, (*result)[i].second));
+  }
+
+  // Truncated input is rejected.
+  EXPECT_FALSE(ExtractBoolBytesArrayFromTupleAsSpans(
+      base::make_span(bytes).first(bytes.size() - 32), 0));
+}
+
 TEST(EthAbiUtilsTest, ExtractFixedBytesFromTuple) {
   auto bytes = ToBytes(GetOffchainLookupResponse());
 
@@ -14,6 +14,8 @@
 #include "base/no_destructor.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/timer/elapsed_timer.h"
 #include "base/trace_event/trace_event.h"
 #include "brave/components/brave_shields/common/features.h"
 #include "brave/components/content_settings/renderer/brave_content_settings_agent_impl.h"
@@ -25,6 +27,7 @@
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "third_party/blink/public/common/browser_interface_broker_proxy.h"
 #include "third_party/blink/public/common/web_preferences/web_preferences.h"
+#include "third_party/blink/public/platform/task_type.h"
 #include "third_party/blink/public/web/blink.h"
 #include "third_party/blink/public/web/web_css_origin.h"
 #include "third_party/blink/public/web/web_document.h"
@@ -187,6 +190,25 @@ class CosmeticFilterPerfTracker {
         TRACE_CATEGORY, "QuerySelectors",
         TRACE_ID_WITH_SCOPE("QuerySelectors", event_id));
   }
+
+  // Each inserted stylesheet invalidates the style of the whole document.
+  void OnStyleSheetInserted(size_t length) {
+    ++style_sheets_inserted_;
+    TRACE_EVENT_INSTANT2(TRACE_CATEGORY, "InsertStyleSheet",
+                         TRACE_EVENT_SCOPE_THREAD, "length", length, "count",
+                         style_sheets_inserted_);
+  }
+
+  void OnScriptExecuted(base::TimeDelta duration) {
+    ++scripts_executed_;
+    TRACE_EVENT_INSTANT2(TRACE_CATEGORY, "ExecuteScript",
+                         TRACE_EVENT_SCOPE_THREAD, "duration_us",
+                         duration.InMicroseconds(), "count", scripts_executed_);
+  }
+
+ private:
+  int style_sheets_inserted_ = 0;
+  int scripts_executed_ = 0;
 };
 
 CosmeticFiltersJSHandler::CosmeticFiltersJSHandler(
@@ -239,6 +261,27 @@ void CosmeticFiltersJSHandler::AddJavaScriptObjectToFrame(
   bundle_injected_ = false;
 }
 
+void CosmeticFiltersJSHandler::ExecuteScript(const std::string& script) {
+  absl::optional<base::ElapsedTimer> timer;
+  if (perf_tracker_)
+    timer.emplace();
+
+  render_frame_->GetWebFrame()->ExecuteScriptInIsolatedWorld(
+      isolated_world_id_,
+      blink::WebScriptSource(blink::WebString::FromUTF8(script)),
+      blink::BackForwardCacheAware::kAllow);
+
+  if (perf_tracker_)
+    perf_tracker_->OnScriptExecuted(timer->Elapsed());
+}
+
+void CosmeticFiltersJSHandler::AppendHideRule(const std::string& selector,
+                                              std::string* stylesheet) {
+  if (!injected_hide_selectors_.insert(selector).second)
+    return;
+  *stylesheet += selector + "{display:none !important}";
+}
+
 // Stylesheets injected this way will be able to override `!important` styles
 // from in-page styles, but cannot be reverted.
 // `WebDocument::RemoveInsertedStyleSheet` works, but using a single stylesheet
@@ -251,6 +294,8 @@ void CosmeticFiltersJSHandler::InjectStylesheet(const std::string& stylesheet) {
       blink::WebString::FromUTF8(stylesheet);
   web_frame->GetDocument().InsertStyleSheet(
       stylesheet_webstring, style_sheet_key, blink::WebCssOrigin::kUser);
+  if (perf_tracker_)
+    perf_tracker_->OnStyleSheetInserted(stylesheet.size());
 }
 
 void CosmeticFiltersJSHandler::CreateWorkerObject(
@@ -342,6 +387,10 @@ bool CosmeticFiltersJSHandler::ProcessURL(
   resources_dict_ = absl::nullopt;
   url_ = url;
   enabled_1st_party_cf_ = false;
+  injected_hide_selectors_.clear();
+  pending_stylesheet_.clear();
+  pending_hide_selectors_.clear();
+  pending_entry_point_ = false;
 
   // Trivially, don't make exceptions for malformed URLs.
   if (!EnsureConnected() || url_.is_empty() || !url_.is_valid())
@@ -416,12 +465,8 @@ void CosmeticFiltersJSHandler::ApplyRules(bool de_amp_enabled) {
                                           de_amp_enabled ? "true" : "false",
                                           scriptlet_script.c_str());
   }
-  if (!scriptlet_script.empty()) {
-    web_frame->ExecuteScriptInIsolatedWorld(
-        isolated_world_id_,
-        blink::WebScriptSource(blink::WebString::FromUTF8(scriptlet_script)),
-        blink::BackForwardCacheAware::kAllow);
-  }
+  if (!scriptlet_script.empty())
+    ExecuteScript(scriptlet_script);
 
   // Working on css rules
   generichide_ = resources_dict_->FindBool("generichide").value_or(false);
@@ -438,10 +483,7 @@ void CosmeticFiltersJSHandler::ApplyRules(bool de_amp_enabled) {
   std::string pre_init_script = base::StringPrintf(
       kPreInitScript, cosmetic_filtering_init_script.c_str());
 
-  web_frame->ExecuteScriptInIsolatedWorld(
-      isolated_world_id_,
-      blink::WebScriptSource(blink::WebString::FromUTF8(pre_init_script)),
-      blink::BackForwardCacheAware::kAllow);
+  ExecuteScript(pre_init_script);
   ExecuteObservingBundleEntryPoint();
 
   CSSRulesRoutine(*resources_dict_);
@@ -452,7 +494,6 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
   SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.CosmeticFilters.CSSRulesRoutine");
   TRACE_EVENT1("brave.adblock", "CSSRulesRoutine", "url", url_.spec());
 
-  blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
   const auto* cf_exceptions_list = resources_dict.FindList("exceptions");
   if (cf_exceptions_list) {
     for (const auto& item : *cf_exceptions_list) {
@@ -475,7 +516,7 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
     if (enabled_1st_party_cf_) {
       for (auto& selector : *hide_selectors_list) {
         DCHECK(selector.is_string());
-        stylesheet += selector.GetString() + "{display:none !important}";
+        AppendHideRule(selector.GetString(), &stylesheet);
       }
     } else {
       std::string json_selectors;
@@ -484,13 +525,8 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
         json_selectors = "[]";
       }
       // Building a script for stylesheet modifications
-      std::string new_selectors_script = base::StringPrintf(
-          kHideSelectorsInjectScript, json_selectors.c_str());
-      web_frame->ExecuteScriptInIsolatedWorld(
-          isolated_world_id_,
-          blink::WebScriptSource(
-              blink::WebString::FromUTF8(new_selectors_script)),
-          blink::BackForwardCacheAware::kAllow);
+      ExecuteScript(base::StringPrintf(kHideSelectorsInjectScript,
+                                       json_selectors.c_str()));
     }
   }
 
@@ -499,7 +535,7 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
   if (force_hide_selectors_list) {
     for (auto& selector : *force_hide_selectors_list) {
       DCHECK(selector.is_string());
-      stylesheet += selector.GetString() + "{display:none !important}";
+      AppendHideRule(selector.GetString(), &stylesheet);
     }
   }
 
@@ -544,53 +580,80 @@ void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
       result.FindList("force_hide_selectors");
   DCHECK(force_hide_selectors);
 
-  if (force_hide_selectors->size() != 0) {
-    std::string stylesheet = "";
-    for (auto& selector : *force_hide_selectors) {
-      DCHECK(selector.is_string());
-      stylesheet += selector.GetString() + "{display:none !important}";
-    }
-    InjectStylesheet(stylesheet);
+  for (auto& selector : *force_hide_selectors) {
+    DCHECK(selector.is_string());
+    AppendHideRule(selector.GetString(), &pending_stylesheet_);
   }
 
   // If its a vetted engine AND we're not in aggressive
   // mode, don't check elements from the default engine (in hide_selectors).
-  if (!enabled_1st_party_cf_ && IsVettedSearchEngine(url_))
+  if (!enabled_1st_party_cf_ && IsVettedSearchEngine(url_)) {
+    ScheduleFlushPendingRules();
     return;
+  }
 
   if (enabled_1st_party_cf_) {
-    std::string stylesheet = "";
     for (auto& selector : *hide_selectors) {
       DCHECK(selector.is_string());
-      stylesheet += selector.GetString() + "{display:none !important}";
+      AppendHideRule(selector.GetString(), &pending_stylesheet_);
     }
-    InjectStylesheet(stylesheet);
   } else {
-    blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
+    // content_cosmetic.ts skips selectors it has already seen, so these are
+    // passed through as is.
+    for (auto& selector : *hide_selectors)
+      pending_hide_selectors_.Append(std::move(selector));
+    pending_entry_point_ = true;
+  }
+  ScheduleFlushPendingRules();
+}
+
+void CosmeticFiltersJSHandler::ScheduleFlushPendingRules() {
+  if (flush_scheduled_)
+    return;
+  flush_scheduled_ = true;
+  // Responses to the requests sent by one mutation batch usually arrive
+  // back to back, so they are all handled by the time this task runs.
+  render_frame_->GetTaskRunner(blink::TaskType::kInternalDefault)
+      ->PostTask(FROM_HERE,
+                 base::BindOnce(&CosmeticFiltersJSHandler::FlushPendingRules,
+                                weak_ptr_factory_.GetWeakPtr()));
+}
+
+void CosmeticFiltersJSHandler::FlushPendingRules() {
+  flush_scheduled_ = false;
+  if (pending_stylesheet_.empty() && pending_hide_selectors_.empty() &&
+      !pending_entry_point_) {
+    return;
+  }
+
+  SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.CosmeticFilters.FlushPendingRules");
+  TRACE_EVENT1("brave.adblock", "FlushPendingRules", "url", url_.spec());
+
+  if (!pending_stylesheet_.empty()) {
+    InjectStylesheet(pending_stylesheet_);
+    pending_stylesheet_.clear();
+  }
+
+  if (!pending_hide_selectors_.empty()) {
     std::string json_selectors;
-    if (!base::JSONWriter::Write(*hide_selectors, &json_selectors) ||
+    if (!base::JSONWriter::Write(pending_hide_selectors_, &json_selectors) ||
         json_selectors.empty()) {
       json_selectors = "[]";
     }
+    pending_hide_selectors_.clear();
     // Building a script for stylesheet modifications
-    std::string new_selectors_script =
-        base::StringPrintf(kHideSelectorsInjectScript, json_selectors.c_str());
-    if (hide_selectors->size() != 0) {
-      web_frame->ExecuteScriptInIsolatedWorld(
-          isolated_world_id_,
-          blink::WebScriptSource(
-              blink::WebString::FromUTF8(new_selectors_script)),
-          blink::BackForwardCacheAware::kAllow);
-    }
+    ExecuteScript(
+        base::StringPrintf(kHideSelectorsInjectScript, json_selectors.c_str()));
+  }
 
-    if (!enabled_1st_party_cf_)
-      ExecuteObservingBundleEntryPoint();
+  if (pending_entry_point_) {
+    pending_entry_point_ = false;
+    ExecuteObservingBundleEntryPoint();
   }
 }
 
 void CosmeticFiltersJSHandler::ExecuteObservingBundleEntryPoint() {
-  blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
-  DCHECK(web_frame);
+  DCHECK(render_frame_->GetWebFrame());
 
   if (!bundle_injected_) {
     SCOPED_UMA_HISTOGRAM_TIMER_MICROS(
@@ -602,20 +665,13 @@ void CosmeticFiltersJSHandler::ExecuteObservingBundleEntryPoint() {
         LoadDataResource(kCosmeticFiltersGenerated[0].id));
     bundle_injected_ = true;
 
-    web_frame->ExecuteScriptInIsolatedWorld(
-        isolated_world_id_,
-        blink::WebScriptSource(blink::WebString::FromUTF8(*s_observing_script)),
-        blink::BackForwardCacheAware::kAllow);
+    ExecuteScript(*s_observing_script);
 
     // kObservingScriptletEntryPoint was called by `s_observing_script`.
     return;
   }
 
-  web_frame->ExecuteScriptInIsolatedWorld(
-      isolated_world_id_,
-      blink::WebScriptSource(
-          blink::WebString::FromUTF8(kObservingScriptletEntryPoint)),
-      blink::BackForwardCacheAware::kAllow);
+  ExecuteScript(kObservingScriptletEntryPoint);
 }
 
 }  // namespace cosmetic_filters
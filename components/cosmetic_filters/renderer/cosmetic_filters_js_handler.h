@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
@@ -71,6 +72,16 @@ class CosmeticFiltersJSHandler {
   void OnEventEnd(const std::string& event_name, int);
 
   void InjectStylesheet(const std::string& stylesheet);
+  void ExecuteScript(const std::string& script);
+
+  // Appends a rule hiding |selector| to |stylesheet| unless the selector is
+  // already hidden in the current document.
+  void AppendHideRule(const std::string& selector, std::string* stylesheet);
+
+  // Selectors arriving from the browser in quick succession are applied
+  // together, with a single stylesheet insertion and a single script run.
+  void ScheduleFlushPendingRules();
+  void FlushPendingRules();
 
   bool generichide_ = false;
 
@@ -86,6 +97,14 @@ class CosmeticFiltersJSHandler {
   // True if the content_cosmetic.bundle.js has injected in the current frame.
   bool bundle_injected_ = false;
 
+  // Selectors of the current document hidden by injected stylesheets.
+  std::unordered_set<std::string> injected_hide_selectors_;
+  // Rules waiting for FlushPendingRules().
+  std::string pending_stylesheet_;
+  base::Value::List pending_hide_selectors_;
+  bool pending_entry_point_ = false;
+  bool flush_scheduled_ = false;
+
   std::unique_ptr<class CosmeticFilterPerfTracker> perf_tracker_;
 
   base::WeakPtrFactory<CosmeticFiltersJSHandler> weak_ptr_factory_{this};
@@ -5,6 +5,8 @@
 
 #include "brave/components/ephemeral_storage/ephemeral_storage_service.h"
 
+#include <algorithm>
+#include <string>
 #include <utility>
 
 #include "base/task/sequenced_task_runner.h"
@@ -28,6 +30,11 @@ namespace ephemeral_storage {
 
 namespace {
 
+// Cleanups due within this window of each other are run as a single batch,
+// so closing many tabs at once doesn't start a cleanup per origin.
+constexpr base::TimeDelta kFirstPartyStorageCleanupBatchWindow =
+    base::Milliseconds(250);
+
 bool IsOriginAcceptableForFirstPartyStorageCleanup(const url::Origin& origin) {
   return !origin.opaque() && (origin.scheme() == url::kHttpScheme ||
                               origin.scheme() == url::kHttpsScheme);
@@ -175,14 +182,16 @@ void EphemeralStorageService::FirstPartyStorageAreaNotInUse(
     return;
   }
 
-  auto cleanup_timer = std::make_unique<base::OneShotTimer>();
-  cleanup_timer->Start(
-      FROM_HERE, first_party_storage_areas_keep_alive_,
-      base::BindOnce(
-          &EphemeralStorageService::CleanupFirstPartyStorageAreaByTimer,
-          weak_ptr_factory_.GetWeakPtr(), origin));
-  first_party_storage_areas_to_cleanup_.emplace(origin,
-                                                std::move(cleanup_timer));
+  const base::TimeTicks deadline =
+      base::TimeTicks::Now() + first_party_storage_areas_keep_alive_;
+  if (!first_party_storage_areas_to_cleanup_.emplace(origin, deadline)
+           .second) {
+    // Already waiting for cleanup.
+    return;
+  }
+  first_party_storage_areas_cleanup_queue_.emplace_back(deadline, origin);
+  ScheduleFirstPartyStorageAreasCleanup();
+
   ScopedListPrefUpdate pref_update(user_prefs::UserPrefs::Get(context_),
                                    kFirstPartyStorageOriginsToCleanup);
   pref_update->Append(base::Value(origin.Serialize()));
@@ -191,6 +200,7 @@ void EphemeralStorageService::FirstPartyStorageAreaNotInUse(
 void EphemeralStorageService::CleanupFirstPartyStorageAreasOnStartup() {
   ScopedListPrefUpdate urls_to_cleanup(user_prefs::UserPrefs::Get(context_),
                                        kFirstPartyStorageOriginsToCleanup);
+  std::vector<url::Origin> origins;
   for (const auto& url_to_cleanup : urls_to_cleanup.Get()) {
     const auto* url_string = url_to_cleanup.GetIfString();
     if (!url_string) {
@@ -200,27 +210,75 @@ void EphemeralStorageService::CleanupFirstPartyStorageAreasOnStartup() {
     if (!url.is_valid()) {
       continue;
     }
-    CleanupFirstPartyStorageArea(url::Origin::Create(url));
+    origins.push_back(url::Origin::Create(url));
   }
+  CleanupFirstPartyStorageAreas(origins);
   urls_to_cleanup->clear();
 }
 
-void EphemeralStorageService::CleanupFirstPartyStorageAreaByTimer(
-    const url::Origin& origin) {
-  DCHECK(base::Contains(first_party_storage_areas_to_cleanup_, origin));
+void EphemeralStorageService::ScheduleFirstPartyStorageAreasCleanup() {
+  if (first_party_storage_areas_cleanup_timer_.IsRunning() ||
+      first_party_storage_areas_cleanup_queue_.empty()) {
+    return;
+  }
+  // The queue is sorted, so a running timer is always armed for the
+  // earliest deadline.
+  const base::TimeDelta delay =
+      first_party_storage_areas_cleanup_queue_.front().first -
+      base::TimeTicks::Now();
+  first_party_storage_areas_cleanup_timer_.Start(
+      FROM_HERE, std::max(delay, base::TimeDelta()),
+      base::BindOnce(
+          &EphemeralStorageService::CleanupFirstPartyStorageAreasByTimer,
+          weak_ptr_factory_.GetWeakPtr()));
+}
 
-  CleanupFirstPartyStorageArea(origin);
+void EphemeralStorageService::CleanupFirstPartyStorageAreasByTimer() {
+  const base::TimeTicks batch_end =
+      base::TimeTicks::Now() + kFirstPartyStorageCleanupBatchWindow;
+  std::vector<url::Origin> origins;
+  while (!first_party_storage_areas_cleanup_queue_.empty() &&
+         first_party_storage_areas_cleanup_queue_.front().first <= batch_end) {
+    auto [deadline, origin] =
+        std::move(first_party_storage_areas_cleanup_queue_.front());
+    first_party_storage_areas_cleanup_queue_.pop_front();
+    auto it = first_party_storage_areas_to_cleanup_.find(origin);
+    // Skip origins that were used again after being queued.
+    if (it == first_party_storage_areas_to_cleanup_.end() ||
+        it->second != deadline) {
+      continue;
+    }
+    first_party_storage_areas_to_cleanup_.erase(it);
+    origins.push_back(std::move(origin));
+  }
 
-  first_party_storage_areas_to_cleanup_.erase(origin);
-  ScopedListPrefUpdate pref_update(user_prefs::UserPrefs::Get(context_),
-                                   kFirstPartyStorageOriginsToCleanup);
-  pref_update->EraseValue(base::Value(origin.Serialize()));
+  if (!origins.empty()) {
+    CleanupFirstPartyStorageAreas(origins);
+
+    base::flat_set<std::string> serialized_origins;
+    for (const auto& origin : origins) {
+      serialized_origins.insert(origin.Serialize());
+    }
+    ScopedListPrefUpdate pref_update(user_prefs::UserPrefs::Get(context_),
+                                     kFirstPartyStorageOriginsToCleanup);
+    pref_update->EraseIf([&serialized_origins](const base::Value& value) {
+      const auto* origin_string = value.GetIfString();
+      return origin_string && serialized_origins.contains(*origin_string);
+    });
+  }
+
+  ScheduleFirstPartyStorageAreasCleanup();
 }
 
-void EphemeralStorageService::CleanupFirstPartyStorageArea(
-    const url::Origin& origin) {
+void EphemeralStorageService::CleanupFirstPartyStorageAreas(
+    const std::vector<url::Origin>& origins) {
   DCHECK(base::FeatureList::IsEnabled(
       net::features::kBraveForgetFirstPartyStorage));
+  if (origins.empty()) {
+    return;
+  }
+
+  // A single removal task for the DOM storage of all origins.
   content::BrowsingDataRemover* remover = context_->GetBrowsingDataRemover();
   content::BrowsingDataRemover::DataType data_to_remove =
       content::BrowsingDataRemover::DATA_TYPE_DOM_STORAGE;
@@ -229,17 +287,27 @@ void EphemeralStorageService::CleanupFirstPartyStorageArea(
       content::BrowsingDataRemover::ORIGIN_TYPE_PROTECTED_WEB;
   auto filter_builder = content::BrowsingDataFilterBuilder::Create(
       content::BrowsingDataFilterBuilder::Mode::kDelete);
-  filter_builder->AddOrigin(origin);
+  for (const auto& origin : origins) {
+    filter_builder->AddOrigin(origin);
+  }
   remover->RemoveWithFilter(base::Time(), base::Time::Max(), data_to_remove,
                             origin_type, std::move(filter_builder));
 
-  const auto& url = net::SchemefulSite(origin).GetURL();
-  auto cookie_deletion_filter = network::mojom::CookieDeletionFilter::New();
-  cookie_deletion_filter->including_domains.emplace({url.host()});
-
-  auto site_instance = content::SiteInstance::CreateForURL(context_, url);
-  auto* storage_partition = context_->GetStoragePartition(site_instance.get());
-  if (storage_partition) {
+  // And a single cookie deletion per storage partition.
+  std::map<content::StoragePartition*, std::vector<std::string>>
+      domains_by_partition;
+  for (const auto& origin : origins) {
+    const auto& url = net::SchemefulSite(origin).GetURL();
+    auto site_instance = content::SiteInstance::CreateForURL(context_, url);
+    auto* storage_partition =
+        context_->GetStoragePartition(site_instance.get());
+    if (storage_partition) {
+      domains_by_partition[storage_partition].push_back(url.host());
+    }
+  }
+  for (auto& [storage_partition, domains] : domains_by_partition) {
+    auto cookie_deletion_filter = network::mojom::CookieDeletionFilter::New();
+    cookie_deletion_filter->including_domains.emplace(std::move(domains));
     storage_partition->GetCookieManagerForBrowserProcess()->DeleteCookies(
         std::move(cookie_deletion_filter), base::NullCallback());
   }
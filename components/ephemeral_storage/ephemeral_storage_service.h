@@ -7,8 +7,10 @@
 #define BRAVE_COMPONENTS_EPHEMERAL_STORAGE_EPHEMERAL_STORAGE_SERVICE_H_
 
 #include <map>
-#include <memory>
+#include <utility>
+#include <vector>
 
+#include "base/containers/circular_deque.h"
 #include "base/containers/flat_set.h"
 #include "base/functional/callback.h"
 #include "base/memory/weak_ptr.h"
@@ -67,8 +69,11 @@ class EphemeralStorageService : public KeyedService {
   // startup. It's impossible to do a cleanup on shutdown, because the process
   // is asynchronous and cannot block the browser shutdown.
   void CleanupFirstPartyStorageAreasOnStartup();
-  void CleanupFirstPartyStorageAreaByTimer(const url::Origin& origin);
-  void CleanupFirstPartyStorageArea(const url::Origin& origin);
+  // Arms the cleanup timer for the earliest pending deadline.
+  void ScheduleFirstPartyStorageAreasCleanup();
+  // Cleans up all origins whose keep alive has expired.
+  void CleanupFirstPartyStorageAreasByTimer();
+  void CleanupFirstPartyStorageAreas(const std::vector<url::Origin>& origins);
 
   raw_ptr<content::BrowserContext> context_ = nullptr;
   raw_ptr<HostContentSettingsMap> host_content_settings_map_ = nullptr;
@@ -76,8 +81,15 @@ class EphemeralStorageService : public KeyedService {
   base::flat_set<ContentSettingsPattern> patterns_to_cleanup_on_shutdown_;
 
   base::TimeDelta first_party_storage_areas_keep_alive_;
-  std::map<url::Origin, std::unique_ptr<base::OneShotTimer>>
-      first_party_storage_areas_to_cleanup_;
+  // Cleanup deadline of every origin waiting for cleanup.
+  std::map<url::Origin, base::TimeTicks> first_party_storage_areas_to_cleanup_;
+  // Pending cleanups ordered by deadline. All origins share the same keep
+  // alive, so appending keeps the queue sorted. Entries of origins that were
+  // used again are dropped when they reach the front.
+  base::circular_deque<std::pair<base::TimeTicks, url::Origin>>
+      first_party_storage_areas_cleanup_queue_;
+  // Single timer for all pending cleanups, fires at the front of the queue.
+  base::OneShotTimer first_party_storage_areas_cleanup_timer_;
 
   base::WeakPtrFactory<EphemeralStorageService> weak_ptr_factory_{this};
 };
@@ -17,6 +17,7 @@
 #include "base/strings/stringprintf.h"
 #include "base/task/thread_pool.h"
 #include "base/time/time.h"
+#include "brave/components/ipfs/import/ipfs_multipart_upload_stream.h"
 #include "brave/components/ipfs/ipfs_constants.h"
 #include "brave/components/ipfs/ipfs_json_parser.h"
 #include "brave/components/ipfs/ipfs_utils.h"
@@ -81,24 +82,17 @@ void IpfsImportWorkerBase::ImportFile(const base::FilePath upload_file_path,
                                       const std::string& mime_type,
                                       const std::string& filename) {
   data_->filename = filename;
-
-  auto upload_callback = base::BindOnce(&IpfsImportWorkerBase::UploadData,
-                                        weak_factory_.GetWeakPtr());
-
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&ipfs::CalculateFileSize, upload_file_path),
-      base::BindOnce(&CreateRequestForFile, upload_file_path,
-                     blob_context_getter_factory_, mime_type, filename,
-                     std::move(upload_callback)));
+  UploadData(IpfsMultipartUploadStream::CreateRequestForFile(
+      upload_file_path, mime_type, filename,
+      base::BindRepeating(&IpfsImportWorkerBase::OnFileUploaded,
+                          weak_factory_.GetWeakPtr())));
 }
 
 void IpfsImportWorkerBase::ImportFolder(const base::FilePath folder_path) {
-  auto upload_callback = base::BindOnce(&IpfsImportWorkerBase::UploadData,
-                                        weak_factory_.GetWeakPtr());
   data_->filename = folder_path.BaseName().MaybeAsASCII();
-  CreateRequestForFolder(folder_path, blob_context_getter_factory_,
-                         std::move(upload_callback));
+  UploadData(IpfsMultipartUploadStream::CreateRequestForFolder(
+      folder_path, base::BindRepeating(&IpfsImportWorkerBase::OnFileUploaded,
+                                       weak_factory_.GetWeakPtr())));
 }
 
 void IpfsImportWorkerBase::ImportText(const std::string& text,
@@ -118,6 +112,15 @@ void IpfsImportWorkerBase::ImportText(const std::string& text,
                        std::move(upload_callback));
 }
 
+void IpfsImportWorkerBase::OnFileUploaded(const base::FilePath& path,
+                                          uint64_t file_size) {
+  uploaded_files_count_++;
+  uploaded_bytes_ += file_size;
+  VLOG(2) << "Uploaded " << path << " (" << file_size << " bytes), "
+          << uploaded_files_count_ << " files and " << uploaded_bytes_
+          << " bytes in total";
+}
+
 void IpfsImportWorkerBase::UploadData(
     std::unique_ptr<network::ResourceRequest> request) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
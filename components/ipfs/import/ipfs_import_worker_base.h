@@ -38,9 +38,10 @@ namespace ipfs {
 // The worker must be deleted when the import is completed.
 // The import process consists of the following steps:
 // Worker:
-//   1. Worker prepares a blob block of data to import
+//   1. Worker prepares a blob block of data to import, files and folders
+//      are streamed from disk instead
 // IpfsImportWorkerBase:
-//   2. Sends blob to ifps using IPFS api (/api/v0/add)
+//   2. Sends data to ifps using IPFS api (/api/v0/add)
 //   3. Creates target directory for import using IPFS api(/api/v0/files/mkdir)
 //   4. Moves objects to target directory using IPFS api(/api/v0/files/cp)
 //   5. Publishes objects under passed IPNS key(/api/v0/name/publish)
@@ -68,6 +69,8 @@ class IpfsImportWorkerBase {
   scoped_refptr<network::SharedURLLoaderFactory> GetUrlLoaderFactory();
 
   virtual void NotifyImportCompleted(ipfs::ImportState state);
+  // Called for every file whose contents have been sent to the node.
+  virtual void OnFileUploaded(const base::FilePath& path, uint64_t file_size);
 
  private:
   void UploadData(std::unique_ptr<network::ResourceRequest> request);
@@ -94,6 +97,8 @@ class IpfsImportWorkerBase {
   std::unique_ptr<network::SimpleURLLoader> simple_url_loader_;
   GURL server_endpoint_;
   std::string key_to_publish_;
+  size_t uploaded_files_count_ = 0;
+  uint64_t uploaded_bytes_ = 0;
   base::WeakPtrFactory<IpfsImportWorkerBase> weak_factory_;
 };
 
@@ -0,0 +1,311 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ipfs/import/ipfs_multipart_upload_stream.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "base/files/file_util.h"
+#include "base/task/bind_post_task.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/ipfs/ipfs_constants.h"
+#include "brave/components/ipfs/ipfs_network_utils.h"
+#include "mojo/public/cpp/bindings/self_owned_receiver.h"
+#include "mojo/public/cpp/system/file_data_source.h"
+#include "mojo/public/cpp/system/string_data_source.h"
+#include "net/base/mime_util.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/resource_request_body.h"
+
+namespace {
+
+bool GetRelativePathComponent(const base::FilePath& parent,
+                              const base::FilePath& child,
+                              base::FilePath::StringType* out) {
+  if (!parent.IsParent(child))
+    return false;
+
+  std::vector<base::FilePath::StringType> parent_components =
+      parent.GetComponents();
+  std::vector<base::FilePath::StringType> child_components =
+      child.GetComponents();
+
+  size_t i = 0;
+  while (i < parent_components.size() &&
+         child_components[i] == parent_components[i]) {
+    ++i;
+  }
+
+  while (i < child_components.size()) {
+    out->append(child_components[i]);
+    if (++i < child_components.size())
+      out->append(FILE_PATH_LITERAL("/"));
+  }
+  return true;
+}
+
+std::unique_ptr<network::ResourceRequest> CreateStreamingRequest(
+    const base::FilePath& path,
+    bool folder,
+    const std::string& mime_type,
+    const std::string& filename,
+    ipfs::IpfsMultipartUploadStream::FileProgressCallback progress_callback) {
+  std::string mime_boundary = net::GenerateMimeMultipartBoundary();
+  if (progress_callback) {
+    progress_callback =
+        base::BindPostTask(base::SequencedTaskRunner::GetCurrentDefault(),
+                           std::move(progress_callback));
+  }
+
+  mojo::PendingRemote<network::mojom::ChunkedDataPipeGetter> stream_remote;
+  auto task_runner = base::ThreadPool::CreateSequencedTaskRunner(
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+  task_runner->PostTask(
+      FROM_HERE,
+      base::BindOnce(&ipfs::IpfsMultipartUploadStream::Bind,
+                     stream_remote.InitWithNewPipeAndPassReceiver(), path,
+                     folder, mime_type, filename, mime_boundary,
+                     std::move(progress_callback)));
+
+  auto request = std::make_unique<network::ResourceRequest>();
+  request->request_body = new network::ResourceRequestBody();
+  request->request_body->SetToChunkedDataPipe(
+      std::move(stream_remote),
+      network::ResourceRequestBody::ReadOnlyOnce(true));
+  std::string content_type = ipfs::kIPFSImportMultipartContentType;
+  content_type += " boundary=";
+  content_type += mime_boundary;
+  request->headers.SetHeader(net::HttpRequestHeaders::kContentType,
+                             content_type);
+  return request;
+}
+
+}  // namespace
+
+namespace ipfs {
+
+// static
+std::unique_ptr<network::ResourceRequest>
+IpfsMultipartUploadStream::CreateRequestForFile(
+    const base::FilePath& upload_file_path,
+    const std::string& mime_type,
+    const std::string& filename,
+    FileProgressCallback progress_callback) {
+  return CreateStreamingRequest(upload_file_path, false, mime_type, filename,
+                                std::move(progress_callback));
+}
+
+// static
+std::unique_ptr<network::ResourceRequest>
+IpfsMultipartUploadStream::CreateRequestForFolder(
+    const base::FilePath& folder_path,
+    FileProgressCallback progress_callback) {
+  return CreateStreamingRequest(folder_path, true, std::string(),
+                                std::string(), std::move(progress_callback));
+}
+
+// static
+void IpfsMultipartUploadStream::Bind(
+    mojo::PendingReceiver<network::mojom::ChunkedDataPipeGetter> receiver,
+    const base::FilePath& path,
+    bool folder,
+    const std::string& mime_type,
+    const std::string& filename,
+    const std::string& mime_boundary,
+    FileProgressCallback progress_callback) {
+  mojo::MakeSelfOwnedReceiver(
+      std::make_unique<IpfsMultipartUploadStream>(
+          path, folder, mime_type, filename, mime_boundary,
+          std::move(progress_callback)),
+      std::move(receiver));
+}
+
+IpfsMultipartUploadStream::IpfsMultipartUploadStream(
+    const base::FilePath& path,
+    bool folder,
+    const std::string& mime_type,
+    const std::string& filename,
+    const std::string& mime_boundary,
+    FileProgressCallback progress_callback)
+    : path_(path),
+      folder_(folder),
+      mime_type_(mime_type),
+      filename_(filename),
+      mime_boundary_(mime_boundary),
+      progress_callback_(std::move(progress_callback)) {}
+
+IpfsMultipartUploadStream::~IpfsMultipartUploadStream() = default;
+
+void IpfsMultipartUploadStream::GetSize(GetSizeCallback callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (status_) {
+    std::move(callback).Run(*status_, bytes_written_);
+    return;
+  }
+  get_size_callback_ = std::move(callback);
+}
+
+void IpfsMultipartUploadStream::StartReading(
+    mojo::ScopedDataPipeProducerHandle pipe) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // The body is generated from a lazy enumeration and can't be rewound.
+  if (started_) {
+    Finish(net::ERR_FAILED);
+    return;
+  }
+  started_ = true;
+  if (folder_) {
+    enumerator_ = std::make_unique<base::FileEnumerator>(
+        path_, true,
+        base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES);
+  }
+  producer_ = std::make_unique<mojo::DataPipeProducer>(std::move(pipe));
+  WriteNextEntry();
+}
+
+absl::optional<IpfsMultipartUploadStream::Entry>
+IpfsMultipartUploadStream::NextEntry() {
+  if (!folder_) {
+    if (file_entry_returned_)
+      return absl::nullopt;
+    file_entry_returned_ = true;
+    Entry entry;
+    entry.path = path_;
+    entry.is_file = true;
+    std::string filename = filename_;
+    if (filename.empty())
+      filename = path_.BaseName().MaybeAsASCII();
+    AddMultipartHeaderForUploadWithFileName(kFileValueName, filename,
+                                            std::string(), mime_boundary_,
+                                            mime_type_, &entry.header);
+    return entry;
+  }
+
+  DCHECK(enumerator_);
+  for (base::FilePath enum_path = enumerator_->Next(); !enum_path.empty();
+       enum_path = enumerator_->Next()) {
+    // Skip symlinks.
+    if (base::IsLink(enum_path))
+      continue;
+    Entry entry;
+    entry.path = enum_path;
+    entry.is_file = !enumerator_->GetInfo().IsDirectory();
+
+    base::FilePath::StringType relative_path;
+    GetRelativePathComponent(path_.DirName(), enum_path, &relative_path);
+    entry.header.append("\r\n");
+    AddMultipartHeaderForUploadWithFileName(
+        kFileValueName, base::FilePath(relative_path).MaybeAsASCII(),
+        enum_path.MaybeAsASCII(), mime_boundary_,
+        entry.is_file ? kFileMimeType : kDirectoryMimeType, &entry.header);
+    return entry;
+  }
+  return absl::nullopt;
+}
+
+void IpfsMultipartUploadStream::WriteNextEntry() {
+  DCHECK(producer_);
+  absl::optional<Entry> entry = NextEntry();
+  if (!entry) {
+    std::string footer = "\r\n";
+    net::AddMultipartFinalDelimiterForUpload(mime_boundary_, &footer);
+    bytes_written_ += footer.size();
+    producer_->Write(
+        std::make_unique<mojo::StringDataSource>(
+            footer, mojo::StringDataSource::AsyncWritingMode::
+                        STRING_MAY_BE_INVALIDATED_BEFORE_COMPLETION),
+        base::BindOnce(&IpfsMultipartUploadStream::OnFooterWritten,
+                       weak_ptr_factory_.GetWeakPtr()));
+    return;
+  }
+
+  base::File file;
+  if (entry->is_file) {
+    file.Initialize(entry->path,
+                    base::File::FLAG_OPEN | base::File::FLAG_READ);
+    if (!file.IsValid()) {
+      VLOG(1) << "Unable to open " << entry->path << " for upload";
+      Finish(net::FileErrorToNetError(file.error_details()));
+      return;
+    }
+  }
+  bytes_written_ += entry->header.size();
+  producer_->Write(
+      std::make_unique<mojo::StringDataSource>(
+          entry->header, mojo::StringDataSource::AsyncWritingMode::
+                             STRING_MAY_BE_INVALIDATED_BEFORE_COMPLETION),
+      base::BindOnce(&IpfsMultipartUploadStream::OnHeaderWritten,
+                     weak_ptr_factory_.GetWeakPtr(), entry->path,
+                     std::move(file)));
+}
+
+void IpfsMultipartUploadStream::OnHeaderWritten(const base::FilePath& path,
+                                                base::File file,
+                                                MojoResult result) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (result != MOJO_RESULT_OK) {
+    Finish(net::ERR_FAILED);
+    return;
+  }
+  // Directories have no content.
+  if (!file.IsValid()) {
+    WriteNextEntry();
+    return;
+  }
+
+  int64_t length = file.GetLength();
+  if (length < 0) {
+    Finish(net::ERR_FAILED);
+    return;
+  }
+  uint64_t file_size = static_cast<uint64_t>(length);
+  // Limit the range to the size known up front, so the reported body size
+  // stays exact even if the file grows during the upload.
+  auto source = std::make_unique<mojo::FileDataSource>(std::move(file));
+  source->SetRange(0, file_size);
+  producer_->Write(
+      std::move(source),
+      base::BindOnce(&IpfsMultipartUploadStream::OnFileWritten,
+                     weak_ptr_factory_.GetWeakPtr(), path, file_size));
+}
+
+void IpfsMultipartUploadStream::OnFileWritten(const base::FilePath& path,
+                                              uint64_t file_size,
+                                              MojoResult result) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (result != MOJO_RESULT_OK) {
+    Finish(net::ERR_FAILED);
+    return;
+  }
+  bytes_written_ += file_size;
+  if (progress_callback_)
+    progress_callback_.Run(path, file_size);
+  WriteNextEntry();
+}
+
+void IpfsMultipartUploadStream::OnFooterWritten(MojoResult result) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  Finish(result == MOJO_RESULT_OK ? net::OK : net::ERR_FAILED);
+}
+
+void IpfsMultipartUploadStream::Finish(int status) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (status_)
+    return;
+  status_ = status;
+  // Closes the pipe, which marks the end of the body.
+  producer_.reset();
+  enumerator_.reset();
+  if (get_size_callback_)
+    std::move(get_size_callback_).Run(status, bytes_written_);
+}
+
+}  // namespace ipfs
@@ -0,0 +1,126 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_IPFS_IMPORT_IPFS_MULTIPART_UPLOAD_STREAM_H_
+#define BRAVE_COMPONENTS_IPFS_IMPORT_IPFS_MULTIPART_UPLOAD_STREAM_H_
+
+#include <memory>
+#include <string>
+
+#include "base/files/file.h"
+#include "base/files/file_enumerator.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+#include "mojo/public/cpp/bindings/pending_receiver.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/data_pipe_producer.h"
+#include "services/network/public/mojom/chunked_data_pipe_getter.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace network {
+struct ResourceRequest;
+}  // namespace network
+
+namespace ipfs {
+
+// Produces the multipart/form-data body of an /api/v0/add request directly
+// from disk. Folders are enumerated lazily and every entry is written into a
+// chunked upload data pipe only when the network service has drained the
+// previous one, so uploads start immediately and memory use doesn't depend
+// on the size of the imported folder.
+// Instances live on a blocking sequence and are owned by their receiver.
+class IpfsMultipartUploadStream
+    : public network::mojom::ChunkedDataPipeGetter {
+ public:
+  // Called on the sequence that created the request once the contents of
+  // a file have been written into the upload pipe.
+  using FileProgressCallback =
+      base::RepeatingCallback<void(const base::FilePath& path,
+                                   uint64_t file_size)>;
+
+  // Returns a request with a chunked body uploading a single file.
+  static std::unique_ptr<network::ResourceRequest> CreateRequestForFile(
+      const base::FilePath& upload_file_path,
+      const std::string& mime_type,
+      const std::string& filename,
+      FileProgressCallback progress_callback);
+  // Returns a request with a chunked body uploading the folder with all of
+  // its files and subdirectories, symlinks are skipped.
+  static std::unique_ptr<network::ResourceRequest> CreateRequestForFolder(
+      const base::FilePath& folder_path,
+      FileProgressCallback progress_callback);
+
+  // Binds a stream on the current sequence, which must allow blocking.
+  // If |folder| is true |path| is enumerated recursively, otherwise it is
+  // uploaded as a single file named |filename|.
+  static void Bind(
+      mojo::PendingReceiver<network::mojom::ChunkedDataPipeGetter> receiver,
+      const base::FilePath& path,
+      bool folder,
+      const std::string& mime_type,
+      const std::string& filename,
+      const std::string& mime_boundary,
+      FileProgressCallback progress_callback);
+
+  IpfsMultipartUploadStream(const base::FilePath& path,
+                            bool folder,
+                            const std::string& mime_type,
+                            const std::string& filename,
+                            const std::string& mime_boundary,
+                            FileProgressCallback progress_callback);
+  ~IpfsMultipartUploadStream() override;
+
+  IpfsMultipartUploadStream(const IpfsMultipartUploadStream&) = delete;
+  IpfsMultipartUploadStream& operator=(const IpfsMultipartUploadStream&) =
+      delete;
+
+  // network::mojom::ChunkedDataPipeGetter
+  void GetSize(GetSizeCallback callback) override;
+  void StartReading(mojo::ScopedDataPipeProducerHandle pipe) override;
+
+ private:
+  struct Entry {
+    base::FilePath path;
+    std::string header;
+    bool is_file = false;
+  };
+
+  // Returns the next entry to upload, absl::nullopt when all entries
+  // have been written.
+  absl::optional<Entry> NextEntry();
+  void WriteNextEntry();
+  void OnHeaderWritten(const base::FilePath& path,
+                       base::File file,
+                       MojoResult result);
+  void OnFileWritten(const base::FilePath& path,
+                     uint64_t file_size,
+                     MojoResult result);
+  void OnFooterWritten(MojoResult result);
+  void Finish(int status);
+
+  const base::FilePath path_;
+  const bool folder_;
+  const std::string mime_type_;
+  const std::string filename_;
+  const std::string mime_boundary_;
+  FileProgressCallback progress_callback_;
+
+  std::unique_ptr<base::FileEnumerator> enumerator_;
+  bool file_entry_returned_ = false;
+  std::unique_ptr<mojo::DataPipeProducer> producer_;
+  bool started_ = false;
+  uint64_t bytes_written_ = 0;
+  absl::optional<int> status_;
+  GetSizeCallback get_size_callback_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+  base::WeakPtrFactory<IpfsMultipartUploadStream> weak_ptr_factory_{this};
+};
+
+}  // namespace ipfs
+
+#endif  // BRAVE_COMPONENTS_IPFS_IMPORT_IPFS_MULTIPART_UPLOAD_STREAM_H_
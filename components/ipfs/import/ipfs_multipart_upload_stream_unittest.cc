@@ -0,0 +1,166 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ipfs/import/ipfs_multipart_upload_stream.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/strings/string_util.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "brave/components/ipfs/ipfs_constants.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe_utils.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
+#include "services/network/public/cpp/data_element.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ipfs {
+
+namespace {
+
+struct UploadResult {
+  std::string body;
+  int status = net::ERR_IO_PENDING;
+  uint64_t size = 0;
+};
+
+}  // namespace
+
+class IpfsMultipartUploadStreamUnitTest : public testing::Test {
+ public:
+  IpfsMultipartUploadStreamUnitTest() = default;
+  ~IpfsMultipartUploadStreamUnitTest() override = default;
+
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  IpfsMultipartUploadStream::FileProgressCallback GetProgressCallback() {
+    return base::BindLambdaForTesting(
+        [&](const base::FilePath& path, uint64_t file_size) {
+          uploaded_files_.emplace_back(path, file_size);
+        });
+  }
+
+  // Reads the request body through a small pipe the way the network service
+  // would, so the stream has to wait for the consumer between chunks.
+  UploadResult ReadBody(std::unique_ptr<network::ResourceRequest> request) {
+    UploadResult result;
+    EXPECT_TRUE(request);
+    EXPECT_EQ(request->request_body->elements()->size(), 1u);
+    auto& element = request->request_body->elements_mutable()->front();
+    EXPECT_EQ(element.type(),
+              network::mojom::DataElementDataView::Tag::kChunkedDataPipe);
+    mojo::Remote<network::mojom::ChunkedDataPipeGetter> getter(
+        element.As<network::DataElementChunkedDataPipe>()
+            .ReleaseChunkedDataPipeGetter());
+
+    mojo::ScopedDataPipeProducerHandle producer;
+    mojo::ScopedDataPipeConsumerHandle consumer;
+    EXPECT_EQ(mojo::CreateDataPipe(4096, producer, consumer), MOJO_RESULT_OK);
+    base::RunLoop run_loop;
+    getter->GetSize(
+        base::BindLambdaForTesting([&](int32_t status, uint64_t size) {
+          result.status = status;
+          result.size = size;
+          run_loop.Quit();
+        }));
+    getter->StartReading(std::move(producer));
+    EXPECT_TRUE(mojo::BlockingCopyToString(std::move(consumer), &result.body));
+    run_loop.Run();
+    return result;
+  }
+
+  const base::FilePath& temp_path() const { return temp_dir_.GetPath(); }
+  const std::vector<std::pair<base::FilePath, uint64_t>>& uploaded_files()
+      const {
+    return uploaded_files_;
+  }
+
+ private:
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  std::vector<std::pair<base::FilePath, uint64_t>> uploaded_files_;
+};
+
+TEST_F(IpfsMultipartUploadStreamUnitTest, UploadFile) {
+  base::FilePath file_path = temp_path().AppendASCII("test.file");
+  // Much bigger than the pipe, the stream has to wait for the reader.
+  std::string content(1024 * 1024, 'a');
+  ASSERT_TRUE(base::WriteFile(file_path, content));
+
+  auto request = IpfsMultipartUploadStream::CreateRequestForFile(
+      file_path, "test/type", "test_name", GetProgressCallback());
+  std::string content_type;
+  ASSERT_TRUE(request->headers.GetHeader(net::HttpRequestHeaders::kContentType,
+                                         &content_type));
+  std::string mime_boundary =
+      content_type.substr(content_type.find("boundary=") + 9);
+
+  auto result = ReadBody(std::move(request));
+  EXPECT_EQ(result.status, net::OK);
+  EXPECT_EQ(result.size, result.body.size());
+  EXPECT_TRUE(base::StartsWith(
+      result.body, "--" + mime_boundary +
+                       "\r\nContent-Disposition: form-data; name=\"file\"; "
+                       "filename=\"test_name\"\r\nContent-Type: test/type"
+                       "\r\n\r\n"));
+  EXPECT_NE(result.body.find(content), std::string::npos);
+  EXPECT_TRUE(base::EndsWith(result.body,
+                             content + "\r\n--" + mime_boundary + "--\r\n"));
+
+  base::RunLoop().RunUntilIdle();
+  ASSERT_EQ(uploaded_files().size(), 1u);
+  EXPECT_EQ(uploaded_files()[0].first, file_path);
+  EXPECT_EQ(uploaded_files()[0].second, content.size());
+}
+
+TEST_F(IpfsMultipartUploadStreamUnitTest, UploadFolder) {
+  base::FilePath folder = temp_path().AppendASCII("folder");
+  ASSERT_TRUE(base::CreateDirectory(folder.AppendASCII("sub")));
+  ASSERT_TRUE(base::WriteFile(folder.AppendASCII("a.txt"), "first file"));
+  ASSERT_TRUE(
+      base::WriteFile(folder.AppendASCII("sub").AppendASCII("b.txt"), "b"));
+
+  auto result = ReadBody(IpfsMultipartUploadStream::CreateRequestForFolder(
+      folder, GetProgressCallback()));
+  EXPECT_EQ(result.status, net::OK);
+  EXPECT_EQ(result.size, result.body.size());
+  EXPECT_NE(result.body.find("filename=\"folder/a.txt\"\r\nContent-Type: " +
+                             std::string(kFileMimeType) +
+                             "\r\n\r\nfirst file"),
+            std::string::npos);
+  EXPECT_NE(result.body.find("filename=\"folder/sub\"\r\nContent-Type: " +
+                             std::string(kDirectoryMimeType)),
+            std::string::npos);
+  EXPECT_NE(result.body.find("filename=\"folder/sub/b.txt\""),
+            std::string::npos);
+
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(uploaded_files().size(), 2u);
+  uint64_t uploaded_bytes = 0;
+  for (const auto& file : uploaded_files())
+    uploaded_bytes += file.second;
+  EXPECT_EQ(uploaded_bytes, 11u);
+}
+
+TEST_F(IpfsMultipartUploadStreamUnitTest, MissingFile) {
+  auto result = ReadBody(IpfsMultipartUploadStream::CreateRequestForFile(
+      temp_path().AppendASCII("missing.file"), "test/type", "test_name",
+      GetProgressCallback()));
+  EXPECT_EQ(result.status, net::ERR_FILE_NOT_FOUND);
+  EXPECT_TRUE(result.body.empty());
+
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(uploaded_files().empty());
+}
+
+}  // namespace ipfs
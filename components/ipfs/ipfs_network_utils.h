@@ -9,7 +9,6 @@
 #include <memory>
 #include <string>
 
-#include "base/files/file_enumerator.h"
 #include "base/functional/callback.h"
 #include "brave/components/ipfs/blob_context_getter_factory.h"
 #include "brave/components/ipfs/buildflags/buildflags.h"
@@ -54,7 +53,6 @@ int64_t CalculateFileSize(base::FilePath upload_file_path);
 using BlobBuilderCallback =
     base::OnceCallback<std::unique_ptr<storage::BlobDataBuilder>()>;
 
-
 using ResourceRequestGetter =
     base::OnceCallback<void(std::unique_ptr<network::ResourceRequest>)>;
 
@@ -65,10 +63,6 @@ void CreateRequestForFile(const base::FilePath& upload_file_path,
                           ResourceRequestGetter request_callback,
                           size_t file_size);
 
-void CreateRequestForFolder(const base::FilePath& folder_path,
-                            BlobContextGetterFactory* context_getter_factory,
-                            ResourceRequestGetter request_callback);
-
 void CreateRequestForText(const std::string& text,
                           const std::string& filename,
                           BlobContextGetterFactory* blob_context_getter_factory,
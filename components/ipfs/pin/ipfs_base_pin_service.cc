@@ -5,11 +5,39 @@
 
 #include "brave/components/ipfs/pin/ipfs_base_pin_service.h"
 
+#include <iterator>
+
+#include "base/auto_reset.h"
+#include "base/check_op.h"
+#include "base/containers/contains.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/ranges/algorithm.h"
+#include "base/task/sequenced_task_runner.h"
 #include "brave/components/ipfs/ipfs_utils.h"
 #include "brave/components/ipfs/pref_names.h"
 
 namespace ipfs {
 
+namespace {
+
+const char kQueueDepthHistogramName[] = "Brave.IPFS.PinService.QueueDepth";
+const char kJobLatencyHistogramName[] = "Brave.IPFS.PinService.JobLatency";
+
+bool JobsConflict(const IpfsBaseJob& first, const IpfsBaseJob& second) {
+  if (first.IsExclusive() || second.IsExclusive()) {
+    return true;
+  }
+  if (first.IsReadOnly() && second.IsReadOnly()) {
+    return false;
+  }
+  const auto second_keys = second.GetKeys();
+  return base::ranges::any_of(first.GetKeys(), [&](const std::string& key) {
+    return base::Contains(second_keys, key);
+  });
+}
+
+}  // namespace
+
 IpfsBaseJob::IpfsBaseJob() = default;
 
 IpfsBaseJob::~IpfsBaseJob() = default;
@@ -18,8 +46,47 @@ void IpfsBaseJob::Cancel() {
   is_canceled_ = true;
 }
 
-IpfsBasePinService::IpfsBasePinService(IpfsService* ipfs_service)
-    : ipfs_service_(ipfs_service) {
+IpfsBaseJob::Type IpfsBaseJob::GetType() const {
+  return Type::kGeneric;
+}
+
+std::vector<std::string> IpfsBaseJob::GetKeys() const {
+  return {};
+}
+
+bool IpfsBaseJob::IsReadOnly() const {
+  return false;
+}
+
+bool IpfsBaseJob::IsExclusive() const {
+  return false;
+}
+
+bool IpfsBaseJob::MergeWith(IpfsBaseJob* other) {
+  return false;
+}
+
+void IpfsBaseJob::NotifyFinished(bool result) {
+  if (finished_callback_) {
+    std::move(finished_callback_).Run(result);
+  }
+}
+
+IpfsBasePinService::JobEntry::JobEntry(std::unique_ptr<IpfsBaseJob> job,
+                                       base::TimeTicks added_time)
+    : job(std::move(job)), added_time(added_time) {}
+
+IpfsBasePinService::JobEntry::JobEntry(JobEntry&&) = default;
+
+IpfsBasePinService::JobEntry& IpfsBasePinService::JobEntry::operator=(
+    JobEntry&&) = default;
+
+IpfsBasePinService::JobEntry::~JobEntry() = default;
+
+IpfsBasePinService::IpfsBasePinService(IpfsService* ipfs_service,
+                                       size_t max_parallel_jobs)
+    : max_parallel_jobs_(max_parallel_jobs), ipfs_service_(ipfs_service) {
+  DCHECK_GT(max_parallel_jobs_, 0u);
   ipfs_service_->AddObserver(this);
 }
 
@@ -33,10 +100,10 @@ IpfsBasePinService::~IpfsBasePinService() {
 
 void IpfsBasePinService::OnIpfsShutdown() {
   daemon_ready_ = false;
-  if (current_job_) {
-    current_job_->Cancel();
-    current_job_.reset();
+  for (auto& entry : running_jobs_) {
+    entry.job->Cancel();
   }
+  running_jobs_.clear();
 }
 
 void IpfsBasePinService::OnGetConnectedPeersResult(
@@ -48,21 +115,23 @@ void IpfsBasePinService::OnGetConnectedPeersResult(
   }
   if (success) {
     daemon_ready_ = true;
-    DoNextJob();
+    DoNextJobs();
   } else {
     PostGetConnectedPeers(attempt++);
   }
 }
 
 void IpfsBasePinService::AddJob(std::unique_ptr<IpfsBaseJob> job) {
-  jobs_.push(std::move(job));
-  if (!current_job_) {
-    DoNextJob();
-  }
+  pending_jobs_.emplace_back(std::move(job), base::TimeTicks::Now());
+  base::UmaHistogramCounts1000(kQueueDepthHistogramName,
+                               pending_jobs_.size() + running_jobs_.size());
+  DoNextJobs();
 }
 
-void IpfsBasePinService::DoNextJob() {
-  if (jobs_.empty()) {
+void IpfsBasePinService::DoNextJobs() {
+  // Jobs may finish synchronously from Start(), the outer call picks up
+  // the freed slots.
+  if (scheduling_ || pending_jobs_.empty()) {
     return;
   }
 
@@ -71,17 +140,64 @@ void IpfsBasePinService::DoNextJob() {
     return;
   }
 
-  DCHECK(!current_job_);
+  base::AutoReset<bool> scheduling(&scheduling_, true);
+  bool job_started = true;
+  while (job_started && running_jobs_.size() < max_parallel_jobs_) {
+    job_started = false;
+    for (auto it = pending_jobs_.begin(); it != pending_jobs_.end(); ++it) {
+      if (CanStart(it)) {
+        StartJob(it);
+        job_started = true;
+        break;
+      }
+      // Exclusive jobs act as a barrier for the jobs added after them.
+      if (it->job->IsExclusive()) {
+        break;
+      }
+    }
+  }
+}
 
-  current_job_ = std::move(jobs_.front());
-  jobs_.pop();
+bool IpfsBasePinService::CanStart(JobList::iterator it) const {
+  if (it->job->IsExclusive() && it != pending_jobs_.begin()) {
+    return false;
+  }
+  for (const auto& entry : running_jobs_) {
+    if (JobsConflict(*entry.job, *it->job)) {
+      return false;
+    }
+  }
+  for (auto prev = pending_jobs_.begin(); prev != it; ++prev) {
+    if (JobsConflict(*prev->job, *it->job)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void IpfsBasePinService::StartJob(JobList::iterator it) {
+  // Batch the adjacent jobs which are ready to run as well.
+  auto next = std::next(it);
+  while (next != pending_jobs_.end() && CanStart(next) &&
+         it->job->MergeWith(next->job.get())) {
+    next = pending_jobs_.erase(next);
+  }
 
-  current_job_->Start();
+  running_jobs_.splice(running_jobs_.end(), pending_jobs_, it);
+  it->job->finished_callback_ =
+      base::BindOnce(&IpfsBasePinService::OnJobFinished,
+                     weak_ptr_factory_.GetWeakPtr(), it);
+  it->job->Start();
 }
 
-void IpfsBasePinService::OnJobDone(bool result) {
-  current_job_.reset();
-  DoNextJob();
+void IpfsBasePinService::OnJobFinished(JobList::iterator it, bool result) {
+  base::UmaHistogramMediumTimes(kJobLatencyHistogramName,
+                                base::TimeTicks::Now() - it->added_time);
+  // The job is still on the stack, so it is destroyed later.
+  base::SequencedTaskRunner::GetCurrentDefault()->DeleteSoon(
+      FROM_HERE, std::move(it->job));
+  running_jobs_.erase(it);
+  DoNextJobs();
 }
 
 bool IpfsBasePinService::IsDaemonReady() {
@@ -107,7 +223,7 @@ void IpfsBasePinService::PostGetConnectedPeers(size_t attempt) {
     return;
   }
 
-  if (jobs_.empty()) {
+  if (pending_jobs_.empty()) {
     return;
   }
 
@@ -131,7 +247,15 @@ void IpfsBasePinService::GetConnectedPeers(size_t attempt) {
 }
 
 bool IpfsBasePinService::HasJobs() {
-  return current_job_ || !jobs_.empty();
+  return !running_jobs_.empty() || !pending_jobs_.empty();
+}
+
+size_t IpfsBasePinService::GetPendingJobsCount() const {
+  return pending_jobs_.size();
+}
+
+size_t IpfsBasePinService::GetRunningJobsCount() const {
+  return running_jobs_.size();
 }
 
 }  // namespace ipfs
@@ -6,12 +6,15 @@
 #ifndef BRAVE_COMPONENTS_IPFS_PIN_IPFS_BASE_PIN_SERVICE_H_
 #define BRAVE_COMPONENTS_IPFS_PIN_IPFS_BASE_PIN_SERVICE_H_
 
+#include <list>
 #include <memory>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/functional/callback.h"
+#include "base/gtest_prod_util.h"
+#include "base/time/time.h"
 #include "brave/components/ipfs/ipfs_service.h"
 #include "components/prefs/pref_service.h"
 
@@ -19,24 +22,57 @@ namespace ipfs {
 
 class IpfsBaseJob {
  public:
+  enum class Type {
+    kGeneric,
+    kAddLocalPin,
+    kRemoveLocalPin,
+    kVerifyLocalPin,
+    kGc
+  };
+
   IpfsBaseJob();
   virtual ~IpfsBaseJob();
   virtual void Start() = 0;
   virtual void Cancel();
 
+  virtual Type GetType() const;
+  // Keys of the records the job works with. Jobs sharing a key are started
+  // in the order they were added unless both of them are read only.
+  virtual std::vector<std::string> GetKeys() const;
+  // Read only jobs don't change the node or the stored records.
+  virtual bool IsReadOnly() const;
+  // Exclusive jobs run alone and hold back every job added after them.
+  virtual bool IsExclusive() const;
+  // Called with a job queued right after this one, returns true if |other|
+  // has been merged into this job and must not be started separately.
+  virtual bool MergeWith(IpfsBaseJob* other);
+
  protected:
+  // Must be called once the job is finished. The job stays alive until the
+  // end of the current task.
+  void NotifyFinished(bool result);
+
   bool is_canceled_ = false;
+
+ private:
+  friend class IpfsBasePinService;
+
+  base::OnceCallback<void(bool)> finished_callback_;
 };
 
 // Manages a queue of IpfsService-related tasks.
+// Up to |max_parallel_jobs| non-conflicting jobs run at the same time.
 // Launches IPFS daemon if needed.
 class IpfsBasePinService : public IpfsServiceObserver {
  public:
-  explicit IpfsBasePinService(IpfsService* service);
+  static constexpr size_t kDefaultMaxParallelJobs = 4;
+
+  explicit IpfsBasePinService(
+      IpfsService* service,
+      size_t max_parallel_jobs = kDefaultMaxParallelJobs);
   ~IpfsBasePinService() override;
 
   virtual void AddJob(std::unique_ptr<IpfsBaseJob> job);
-  void OnJobDone(bool result);
   void OnGetConnectedPeersResult(size_t attempt,
                                  bool succes,
                                  const std::vector<std::string>& peers);
@@ -44,6 +80,8 @@ class IpfsBasePinService : public IpfsServiceObserver {
   void OnIpfsShutdown() override;
 
   bool HasJobs();
+  size_t GetPendingJobsCount() const;
+  size_t GetRunningJobsCount() const;
 
  protected:
   // For testing
@@ -53,16 +91,32 @@ class IpfsBasePinService : public IpfsServiceObserver {
   FRIEND_TEST_ALL_PREFIXES(IpfsBasePinServiceTest, OnGetConnectedPeers);
   FRIEND_TEST_ALL_PREFIXES(IpfsBasePinServiceTest, OnIpfsShutdown);
 
+  struct JobEntry {
+    JobEntry(std::unique_ptr<IpfsBaseJob> job, base::TimeTicks added_time);
+    JobEntry(JobEntry&&);
+    JobEntry& operator=(JobEntry&&);
+    ~JobEntry();
+
+    std::unique_ptr<IpfsBaseJob> job;
+    base::TimeTicks added_time;
+  };
+  using JobList = std::list<JobEntry>;
+
   bool IsDaemonReady();
   void MaybeStartDaemon();
-  void DoNextJob();
+  void DoNextJobs();
+  bool CanStart(JobList::iterator it) const;
+  void StartJob(JobList::iterator it);
+  void OnJobFinished(JobList::iterator it, bool result);
   void PostGetConnectedPeers(size_t attempt);
   void GetConnectedPeers(size_t attempt);
 
   bool daemon_ready_ = false;
+  bool scheduling_ = false;
+  size_t max_parallel_jobs_ = kDefaultMaxParallelJobs;
   raw_ptr<IpfsService> ipfs_service_;
-  std::unique_ptr<IpfsBaseJob> current_job_;
-  std::queue<std::unique_ptr<IpfsBaseJob>> jobs_;
+  JobList running_jobs_;
+  JobList pending_jobs_;
 
   base::WeakPtrFactory<IpfsBasePinService> weak_ptr_factory_{this};
 };
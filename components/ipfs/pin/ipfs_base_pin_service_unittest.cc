@@ -6,9 +6,13 @@
 #include "brave/components/ipfs/pin/ipfs_base_pin_service.h"
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "base/strings/string_number_conversions.h"
 #include "base/test/bind.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/time/time_override.h"
 #include "brave/components/ipfs/ipfs_service.h"
 #include "brave/components/ipfs/pref_names.h"
@@ -66,7 +70,11 @@ class IpfsBasePinServiceTest : public testing::Test {
 
 class MockJob : public IpfsBaseJob {
  public:
-  explicit MockJob(base::OnceCallback<void()> callback) {
+  explicit MockJob(base::OnceCallback<void()> callback,
+                   const std::string& key = "key",
+                   bool read_only = false,
+                   bool exclusive = false)
+      : key_(key), read_only_(read_only), exclusive_(exclusive) {
     callback_ = std::move(callback);
   }
 
@@ -76,8 +84,30 @@ class MockJob : public IpfsBaseJob {
     }
   }
 
+  std::vector<std::string> GetKeys() const override { return {key_}; }
+  bool IsReadOnly() const override { return read_only_; }
+  bool IsExclusive() const override { return exclusive_; }
+
+  bool MergeWith(IpfsBaseJob* other) override {
+    if (!mergeable_) {
+      return false;
+    }
+    merged_jobs_count_++;
+    return true;
+  }
+
+  void Finish(bool result) { NotifyFinished(result); }
+
+  void set_mergeable(bool mergeable) { mergeable_ = mergeable; }
+  size_t merged_jobs_count() const { return merged_jobs_count_; }
+
  private:
   base::OnceCallback<void()> callback_;
+  std::string key_;
+  bool read_only_ = false;
+  bool exclusive_ = false;
+  bool mergeable_ = false;
+  size_t merged_jobs_count_ = 0;
 };
 
 TEST_F(IpfsBasePinServiceTest, TasksExecuted) {
@@ -85,9 +115,11 @@ TEST_F(IpfsBasePinServiceTest, TasksExecuted) {
   absl::optional<bool> method_called;
   std::unique_ptr<MockJob> first_job = std::make_unique<MockJob>(
       base::BindLambdaForTesting([&method_called]() { method_called = true; }));
+  auto* first_job_ptr = first_job.get();
   service()->AddJob(std::move(first_job));
   EXPECT_TRUE(method_called.value());
 
+  // Jobs for the same key run one after another.
   absl::optional<bool> second_method_called;
   std::unique_ptr<MockJob> second_job =
       std::make_unique<MockJob>(base::BindLambdaForTesting(
@@ -95,10 +127,110 @@ TEST_F(IpfsBasePinServiceTest, TasksExecuted) {
   service()->AddJob(std::move(second_job));
   EXPECT_FALSE(second_method_called.has_value());
 
-  service()->OnJobDone(true);
+  first_job_ptr->Finish(true);
   EXPECT_TRUE(second_method_called.value());
 }
 
+TEST_F(IpfsBasePinServiceTest, ParallelJobs) {
+  base::HistogramTester histogram_tester;
+  service()->OnGetConnectedPeersResult(1, true, {});
+  size_t started_jobs = 0;
+  std::vector<MockJob*> jobs;
+  for (size_t i = 0; i < IpfsBasePinService::kDefaultMaxParallelJobs + 1;
+       i++) {
+    auto job = std::make_unique<MockJob>(
+        base::BindLambdaForTesting([&started_jobs]() { started_jobs++; }),
+        base::NumberToString(i));
+    jobs.push_back(job.get());
+    service()->AddJob(std::move(job));
+  }
+
+  EXPECT_EQ(IpfsBasePinService::kDefaultMaxParallelJobs, started_jobs);
+  EXPECT_EQ(IpfsBasePinService::kDefaultMaxParallelJobs,
+            service()->GetRunningJobsCount());
+  EXPECT_EQ(1u, service()->GetPendingJobsCount());
+  histogram_tester.ExpectBucketCount(
+      "Brave.IPFS.PinService.QueueDepth",
+      IpfsBasePinService::kDefaultMaxParallelJobs + 1, 1);
+
+  jobs[1]->Finish(true);
+  EXPECT_EQ(IpfsBasePinService::kDefaultMaxParallelJobs + 1, started_jobs);
+  EXPECT_EQ(0u, service()->GetPendingJobsCount());
+  histogram_tester.ExpectTotalCount("Brave.IPFS.PinService.JobLatency", 1);
+}
+
+TEST_F(IpfsBasePinServiceTest, ReadOnlyJobsOverlap) {
+  service()->OnGetConnectedPeersResult(1, true, {});
+  size_t started_jobs = 0;
+  auto count_job = base::BindLambdaForTesting([&]() { started_jobs++; });
+
+  auto first_job = std::make_unique<MockJob>(count_job, "a", true);
+  auto* first_job_ptr = first_job.get();
+  service()->AddJob(std::move(first_job));
+  service()->AddJob(std::make_unique<MockJob>(count_job, "a", true));
+  EXPECT_EQ(2u, started_jobs);
+
+  // A write for the same key waits for the reads.
+  service()->AddJob(std::make_unique<MockJob>(count_job, "a"));
+  EXPECT_EQ(2u, started_jobs);
+  // A later read doesn't overtake the write.
+  service()->AddJob(std::make_unique<MockJob>(count_job, "a", true));
+  EXPECT_EQ(2u, started_jobs);
+  // Writes for other keys aren't blocked.
+  service()->AddJob(std::make_unique<MockJob>(count_job, "b"));
+  EXPECT_EQ(3u, started_jobs);
+
+  first_job_ptr->Finish(true);
+  EXPECT_EQ(3u, started_jobs);
+}
+
+TEST_F(IpfsBasePinServiceTest, ExclusiveJob) {
+  service()->OnGetConnectedPeersResult(1, true, {});
+  size_t started_jobs = 0;
+  auto count_job = base::BindLambdaForTesting([&]() { started_jobs++; });
+
+  auto first_job = std::make_unique<MockJob>(count_job, "a");
+  auto* first_job_ptr = first_job.get();
+  service()->AddJob(std::move(first_job));
+  auto exclusive_job = std::make_unique<MockJob>(count_job, "", false, true);
+  auto* exclusive_job_ptr = exclusive_job.get();
+  service()->AddJob(std::move(exclusive_job));
+  service()->AddJob(std::make_unique<MockJob>(count_job, "b"));
+  EXPECT_EQ(1u, started_jobs);
+
+  first_job_ptr->Finish(true);
+  EXPECT_EQ(2u, started_jobs);
+  EXPECT_EQ(1u, service()->GetRunningJobsCount());
+
+  exclusive_job_ptr->Finish(true);
+  EXPECT_EQ(3u, started_jobs);
+}
+
+TEST_F(IpfsBasePinServiceTest, AdjacentJobsMerged) {
+  service()->OnGetConnectedPeersResult(1, true, {});
+  size_t started_jobs = 0;
+  auto count_job = base::BindLambdaForTesting([&]() { started_jobs++; });
+
+  auto first_job = std::make_unique<MockJob>(count_job, "", false, true);
+  auto* first_job_ptr = first_job.get();
+  service()->AddJob(std::move(first_job));
+
+  auto second_job = std::make_unique<MockJob>(count_job, "a");
+  auto* second_job_ptr = second_job.get();
+  second_job->set_mergeable(true);
+  service()->AddJob(std::move(second_job));
+  service()->AddJob(std::make_unique<MockJob>(count_job, "b"));
+  service()->AddJob(std::make_unique<MockJob>(count_job, "c"));
+  EXPECT_EQ(1u, started_jobs);
+
+  // Jobs waiting behind the exclusive job are started as one batch.
+
+  first_job_ptr->Finish(true);
+  EXPECT_EQ(2u, started_jobs);
+  EXPECT_EQ(2u, second_job_ptr->merged_jobs_count());
+  EXPECT_EQ(0u, service()->GetPendingJobsCount());
+}
+
 TEST_F(IpfsBasePinServiceTest, OnIpfsShutdown) {
   service()->OnGetConnectedPeersResult(1, true, {});
   EXPECT_TRUE(service()->daemon_ready_);
@@ -113,13 +245,8 @@ TEST_F(IpfsBasePinServiceTest, OnIpfsShutdown) {
 
   service()->OnIpfsShutdown();
 
-  EXPECT_EQ(1u, service()->jobs_.size());
-  EXPECT_FALSE(service()->current_job_);
-
-  service()->OnJobDone(false);
-
-  EXPECT_EQ(1u, service()->jobs_.size());
-  EXPECT_FALSE(service()->current_job_);
+  EXPECT_EQ(1u, service()->pending_jobs_.size());
+  EXPECT_TRUE(service()->running_jobs_.empty());
 }
 
 TEST_F(IpfsBasePinServiceTest, OnGetConnectedPeers) {
@@ -128,8 +255,10 @@ TEST_F(IpfsBasePinServiceTest, OnGetConnectedPeers) {
 
   std::unique_ptr<MockJob> first_job =
       std::make_unique<MockJob>(base::DoNothing());
+  auto* first_job_ptr = first_job.get();
   std::unique_ptr<MockJob> second_job =
       std::make_unique<MockJob>(base::DoNothing());
+  auto* second_job_ptr = second_job.get();
 
   service()->AddJob(std::move(first_job));
 
@@ -139,18 +268,18 @@ TEST_F(IpfsBasePinServiceTest, OnGetConnectedPeers) {
 
   service()->OnGetConnectedPeersResult(1, true, {});
 
-  EXPECT_EQ(1u, service()->jobs_.size());
-  EXPECT_TRUE(service()->current_job_);
+  EXPECT_EQ(1u, service()->pending_jobs_.size());
+  EXPECT_EQ(1u, service()->running_jobs_.size());
 
-  service()->OnJobDone(true);
+  first_job_ptr->Finish(true);
 
-  EXPECT_EQ(0u, service()->jobs_.size());
-  EXPECT_TRUE(service()->current_job_);
+  EXPECT_EQ(0u, service()->pending_jobs_.size());
+  EXPECT_EQ(1u, service()->running_jobs_.size());
 
-  service()->OnJobDone(true);
+  second_job_ptr->Finish(true);
 
-  EXPECT_EQ(0u, service()->jobs_.size());
-  EXPECT_FALSE(service()->current_job_);
+  EXPECT_EQ(0u, service()->pending_jobs_.size());
+  EXPECT_TRUE(service()->running_jobs_.empty());
 }
 
 TEST_F(IpfsBasePinServiceTest, OnGetConnectedPeers_Retry) {
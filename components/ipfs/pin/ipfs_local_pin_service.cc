@@ -12,6 +12,7 @@
 
 #include "base/containers/contains.h"
 #include "base/functional/callback.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/strcat.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
@@ -27,6 +28,8 @@ bool PinData::operator==(const PinData& d) const {
 namespace {
 const char kRecursiveMode[] = "recursive";
 const char kDirectMode[] = "direct";
+// Limits the number of pin requests sent to the node in one call.
+constexpr size_t kMaxMergedAddJobs = 16;
 
 std::string GetPrefNameFromPinningMode(PinningMode mode) {
   switch (mode) {
@@ -85,41 +88,88 @@ IpfsLocalPinService::ExtractMergedPinData(
   return result;
 }
 
+AddLocalPinJob::Request::Request(const std::string& key,
+                                 const std::vector<PinData>& pins_data,
+                                 AddPinCallback callback)
+    : key(key), pins_data(pins_data), callback(std::move(callback)) {}
+
+AddLocalPinJob::Request::Request(Request&&) = default;
+
+AddLocalPinJob::Request& AddLocalPinJob::Request::operator=(Request&&) =
+    default;
+
+AddLocalPinJob::Request::~Request() = default;
+
 AddLocalPinJob::AddLocalPinJob(PrefService* prefs_service,
                                IpfsService* ipfs_service,
                                const std::string& key,
                                const std::vector<PinData>& pins_data,
                                AddPinCallback callback)
-    : prefs_service_(prefs_service),
-      ipfs_service_(ipfs_service),
-      key_(key),
-      pins_data_(pins_data),
-      callback_(std::move(callback)) {}
+    : prefs_service_(prefs_service), ipfs_service_(ipfs_service) {
+  requests_.emplace_back(key, pins_data, std::move(callback));
+}
 
 AddLocalPinJob::~AddLocalPinJob() = default;
 
-void AddLocalPinJob::Start() {
-  auto callback = base::BarrierCallback<absl::optional<AddPinResult>>(
-      2, base::BindOnce(&AddLocalPinJob::OnAddPinResult,
-                        weak_ptr_factory_.GetWeakPtr()));
+IpfsBaseJob::Type AddLocalPinJob::GetType() const {
+  return Type::kAddLocalPin;
+}
 
-  std::vector<std::string> recursive_cids;
-  std::vector<std::string> direct_cids;
+std::vector<std::string> AddLocalPinJob::GetKeys() const {
+  std::vector<std::string> keys;
+  for (const auto& request : requests_) {
+    keys.push_back(request.key);
+  }
+  return keys;
+}
 
-  for (const auto& pin_data : pins_data_) {
-    if (pin_data.pinning_mode == PinningMode::RECURSIVE) {
-      recursive_cids.push_back(pin_data.cid);
-    } else {
-      direct_cids.push_back(pin_data.cid);
+bool AddLocalPinJob::MergeWith(IpfsBaseJob* other) {
+  if (other->GetType() != Type::kAddLocalPin ||
+      requests_.size() >= kMaxMergedAddJobs) {
+    return false;
+  }
+  auto* other_job = static_cast<AddLocalPinJob*>(other);
+  if (requests_.size() + other_job->requests_.size() > kMaxMergedAddJobs) {
+    return false;
+  }
+  for (auto& request : other_job->requests_) {
+    requests_.push_back(std::move(request));
+  }
+  other_job->requests_.clear();
+  return true;
+}
+
+void AddLocalPinJob::Start() {
+  PinRequests(0, requests_.size());
+}
+
+std::vector<std::string> AddLocalPinJob::GetCids(size_t first,
+                                                 size_t count,
+                                                 PinningMode mode) const {
+  std::vector<std::string> cids;
+  for (size_t i = first; i < first + count; i++) {
+    for (const auto& pin_data : requests_[i].pins_data) {
+      if (pin_data.pinning_mode == mode &&
+          !base::Contains(cids, pin_data.cid)) {
+        cids.push_back(pin_data.cid);
+      }
     }
   }
+  return cids;
+}
+
+void AddLocalPinJob::PinRequests(size_t first, size_t count) {
+  pinning_failed_ = false;
+  auto callback = base::BarrierCallback<absl::optional<AddPinResult>>(
+      2, base::BindOnce(&AddLocalPinJob::OnAddPinResult,
+                        weak_ptr_factory_.GetWeakPtr(), first, count));
 
   ipfs_service_->AddPin(
-      recursive_cids, true,
+      GetCids(first, count, PinningMode::RECURSIVE), true,
       base::BindOnce(&AddLocalPinJob::Accumulate,
                      weak_ptr_factory_.GetWeakPtr(), callback));
   ipfs_service_->AddPin(
-      direct_cids, false,
+      GetCids(first, count, PinningMode::DIRECT), false,
       base::BindOnce(&AddLocalPinJob::Accumulate,
                      weak_ptr_factory_.GetWeakPtr(), callback));
 }
@@ -135,33 +185,93 @@ void AddLocalPinJob::Accumulate(
 }
 
 void AddLocalPinJob::OnAddPinResult(
+    size_t first,
+    size_t count,
     std::vector<absl::optional<AddPinResult>> result) {
   if (is_canceled_) {
-    std::move(callback_).Run(false);
+    Finish(false);
     return;
   }
 
-  if (pinning_failed_) {
-    std::move(callback_).Run(false);
+  const bool success =
+      !pinning_failed_ && SavePinnedCids(first, count, result);
+  if (!success && count > 1) {
+    // A single unavailable CID fails the whole call, so the requests of a
+    // merged job are retried one by one and fail on their own.
+    PinRequests(first, 1);
+    return;
+  }
+  if (count == requests_.size()) {
+    Finish(success);
     return;
   }
 
-  {
-    ScopedDictPrefUpdate update(prefs_service_, kIPFSPinnedCids);
-    base::Value::Dict& update_dict = update.Get();
+  all_succeeded_ &= success;
+  auto weak_this = weak_ptr_factory_.GetWeakPtr();
+  std::move(requests_[first].callback).Run(success);
+  if (!weak_this) {
+    return;
+  }
+  if (first + 1 < requests_.size()) {
+    PinRequests(first + 1, 1);
+    return;
+  }
+  Finish(all_succeeded_);
+}
 
+bool AddLocalPinJob::SavePinnedCids(
+    size_t first,
+    size_t count,
+    const std::vector<absl::optional<AddPinResult>>& result) {
+  if (count > 1) {
+    // Arguments are deduplicated and the node reports one pin per argument,
+    // in their order, so every pin can be attributed to the requests which
+    // asked for its argument.
     for (const auto& add_pin_result : result) {
-      auto* mode_dict = update_dict.EnsureDict(GetPrefNameFromPinningMode(
-          add_pin_result->recursive ? PinningMode::RECURSIVE
-                                    : PinningMode::DIRECT));
-      for (const auto& cid : add_pin_result->pins) {
-        base::Value::List* list = mode_dict->EnsureList(cid);
-        list->EraseValue(base::Value(key_));
-        list->Append(base::Value(key_));
+      PinningMode mode = add_pin_result->recursive ? PinningMode::RECURSIVE
+                                                   : PinningMode::DIRECT;
+      if (add_pin_result->pins.size() != GetCids(first, count, mode).size()) {
+        return false;
       }
     }
   }
-  std::move(callback_).Run(true);
+
+  ScopedDictPrefUpdate update(prefs_service_, kIPFSPinnedCids);
+  base::Value::Dict& update_dict = update.Get();
+
+  for (const auto& add_pin_result : result) {
+    PinningMode mode = add_pin_result->recursive ? PinningMode::RECURSIVE
+                                                 : PinningMode::DIRECT;
+    auto* mode_dict = update_dict.EnsureDict(GetPrefNameFromPinningMode(mode));
+    const auto cids = GetCids(first, count, mode);
+    for (size_t pin_index = 0; pin_index < add_pin_result->pins.size();
+         pin_index++) {
+      base::Value::List* list =
+          mode_dict->EnsureList(add_pin_result->pins[pin_index]);
+      for (size_t i = first; i < first + count; i++) {
+        const auto& request = requests_[i];
+        if (count > 1 &&
+            !base::Contains(request.pins_data,
+                            PinData{cids[pin_index], mode})) {
+          continue;
+        }
+        list->EraseValue(base::Value(request.key));
+        list->Append(base::Value(request.key));
+      }
+    }
+  }
+  return true;
+}
+
+void AddLocalPinJob::Finish(bool result) {
+  auto requests = std::move(requests_);
+  NotifyFinished(result);
+  for (auto& request : requests) {
+    // Requests of a split job may have been answered already.
+    if (request.callback) {
+      std::move(request.callback).Run(result);
+    }
+  }
 }
 
 RemoveLocalPinJob::RemoveLocalPinJob(PrefService* prefs_service,
@@ -173,6 +283,14 @@ RemoveLocalPinJob::RemoveLocalPinJob(PrefService* prefs_service,
 
 RemoveLocalPinJob::~RemoveLocalPinJob() = default;
 
+IpfsBaseJob::Type RemoveLocalPinJob::GetType() const {
+  return Type::kRemoveLocalPin;
+}
+
+std::vector<std::string> RemoveLocalPinJob::GetKeys() const {
+  return {key_};
+}
+
 void RemoveLocalPinJob::Start() {
   {
     ScopedDictPrefUpdate update(prefs_service_, kIPFSPinnedCids);
@@ -201,6 +319,7 @@ void RemoveLocalPinJob::Start() {
       }
     }
   }
+  NotifyFinished(true);
   std::move(callback_).Run(true);
 }
 
@@ -217,6 +336,18 @@ VerifyLocalPinJob::VerifyLocalPinJob(PrefService* prefs_service,
 
 VerifyLocalPinJob::~VerifyLocalPinJob() = default;
 
+IpfsBaseJob::Type VerifyLocalPinJob::GetType() const {
+  return Type::kVerifyLocalPin;
+}
+
+std::vector<std::string> VerifyLocalPinJob::GetKeys() const {
+  return {key_};
+}
+
+bool VerifyLocalPinJob::IsReadOnly() const {
+  return true;
+}
+
 void VerifyLocalPinJob::Start() {
   std::vector<std::string> cids;
   for (const auto& pin_data : pins_data_) {
@@ -229,18 +360,14 @@ void VerifyLocalPinJob::Start() {
 }
 
 void VerifyLocalPinJob::OnGetPinsResult(absl::optional<GetPinsResult> result) {
-  if (is_canceled_) {
-    std::move(callback_).Run(absl::nullopt);
-    return;
+  absl::optional<bool> verified;
+  if (!is_canceled_) {
+    // TODO(cypt4): Check exact pinning modes for each cid.
+    verified = result && result->size() == pins_data_.size();
   }
 
-  if (!result) {
-    std::move(callback_).Run(false);
-    return;
-  }
-
-  // TODO(cypt4): Check exact pinning modes for each cid.
-  std::move(callback_).Run(result->size() == pins_data_.size());
+  NotifyFinished(verified.value_or(false));
+  std::move(callback_).Run(verified);
 }
 
 GcJob::GcJob(PrefService* prefs_service,
@@ -252,6 +379,16 @@ GcJob::GcJob(PrefService* prefs_service,
 
 GcJob::~GcJob() = default;
 
+IpfsBaseJob::Type GcJob::GetType() const {
+  return Type::kGc;
+}
+
+bool GcJob::IsExclusive() const {
+  // Pins added while the node is listed would be collected before their
+  // records are stored.
+  return true;
+}
+
 void GcJob::Start() {
   auto callback = base::BarrierCallback<absl::optional<GetPinsResult>>(
       2,
@@ -277,13 +414,8 @@ void GcJob::Accumulate(
 }
 
 void GcJob::OnGetPinsResult(std::vector<absl::optional<GetPinsResult>> result) {
-  if (is_canceled_) {
-    std::move(callback_).Run(false);
-    return;
-  }
-
-  if (gc_job_failed_) {
-    std::move(callback_).Run(false);
+  if (is_canceled_ || gc_job_failed_) {
+    Finish(false);
     return;
   }
 
@@ -310,12 +442,17 @@ void GcJob::OnGetPinsResult(std::vector<absl::optional<GetPinsResult>> result) {
                              base::BindOnce(&GcJob::OnPinsRemovedResult,
                                             weak_ptr_factory_.GetWeakPtr()));
   } else {
-    std::move(callback_).Run(true);
+    Finish(true);
   }
 }
 
 void GcJob::OnPinsRemovedResult(absl::optional<RemovePinResult> result) {
-  std::move(callback_).Run(result.has_value());
+  Finish(result.has_value());
+}
+
+void GcJob::Finish(bool result) {
+  NotifyFinished(result);
+  std::move(callback_).Run(result);
 }
 
 IpfsLocalPinService::IpfsLocalPinService(PrefService* prefs_service,
@@ -429,19 +566,16 @@ void IpfsLocalPinService::OnRemovePinsFinished(RemovePinCallback callback,
                        weak_ptr_factory_.GetWeakPtr()),
         base::Minutes(1));
   }
-  ipfs_base_pin_service_->OnJobDone(status);
 }
 
 void IpfsLocalPinService::OnAddJobFinished(AddPinCallback callback,
                                            bool status) {
   std::move(callback).Run(status);
-  ipfs_base_pin_service_->OnJobDone(status);
 }
 
 void IpfsLocalPinService::OnValidateJobFinished(ValidatePinsCallback callback,
                                                 absl::optional<bool> status) {
   std::move(callback).Run(status);
-  ipfs_base_pin_service_->OnJobDone(status.value_or(false));
 }
 
 void IpfsLocalPinService::AddGcTask() {
@@ -457,7 +591,6 @@ void IpfsLocalPinService::AddGcTask() {
 
 void IpfsLocalPinService::OnGcFinishedCallback(bool status) {
   gc_task_posted_ = false;
-  ipfs_base_pin_service_->OnJobDone(status);
 }
 
 bool IpfsLocalPinService::HasJobs() {
@@ -72,20 +72,48 @@ class AddLocalPinJob : public IpfsBaseJob {
   ~AddLocalPinJob() override;
 
   void Start() override;
+  Type GetType() const override;
+  std::vector<std::string> GetKeys() const override;
+  // Adjacent add jobs are sent to the node as one pair of pin/add calls.
+  bool MergeWith(IpfsBaseJob* other) override;
 
  private:
+  struct Request {
+    Request(const std::string& key,
+            const std::vector<PinData>& pins_data,
+            AddPinCallback callback);
+    Request(Request&&);
+    Request& operator=(Request&&);
+    ~Request();
+
+    std::string key;
+    std::vector<PinData> pins_data;
+    AddPinCallback callback;
+  };
+
+  // Unique CIDs of |requests_| in [first, first + count) for |mode|.
+  std::vector<std::string> GetCids(size_t first,
+                                   size_t count,
+                                   PinningMode mode) const;
+  void PinRequests(size_t first, size_t count);
   void Accumulate(
       base::OnceCallback<void(absl::optional<AddPinResult>)> callback,
       absl::optional<AddPinResult> result);
-  void OnAddPinResult(std::vector<absl::optional<AddPinResult>> result);
+  void OnAddPinResult(size_t first,
+                      size_t count,
+                      std::vector<absl::optional<AddPinResult>> result);
+  bool SavePinnedCids(size_t first,
+                      size_t count,
+                      const std::vector<absl::optional<AddPinResult>>& result);
+  void Finish(bool result);
 
   raw_ptr<PrefService> prefs_service_;
   raw_ptr<IpfsService> ipfs_service_;
-  std::string key_;
-  std::vector<PinData> pins_data_;
-  AddPinCallback callback_;
+  std::vector<Request> requests_;
 
   bool pinning_failed_ = false;
+  // Whether all requests succeeded after a merged job was split.
+  bool all_succeeded_ = true;
 
   base::WeakPtrFactory<AddLocalPinJob> weak_ptr_factory_{this};
 };
@@ -99,6 +127,8 @@ class RemoveLocalPinJob : public IpfsBaseJob {
   ~RemoveLocalPinJob() override;
 
   void Start() override;
+  Type GetType() const override;
+  std::vector<std::string> GetKeys() const override;
 
  private:
   raw_ptr<PrefService> prefs_service_;
@@ -118,6 +148,9 @@ class VerifyLocalPinJob : public IpfsBaseJob {
   ~VerifyLocalPinJob() override;
 
   void Start() override;
+  Type GetType() const override;
+  std::vector<std::string> GetKeys() const override;
+  bool IsReadOnly() const override;
 
  private:
   void OnGetPinsResult(absl::optional<GetPinsResult> result);
@@ -139,6 +172,8 @@ class GcJob : public IpfsBaseJob {
   ~GcJob() override;
 
   void Start() override;
+  Type GetType() const override;
+  bool IsExclusive() const override;
 
  private:
   void Accumulate(
@@ -146,6 +181,7 @@ class GcJob : public IpfsBaseJob {
       absl::optional<GetPinsResult> result);
   void OnGetPinsResult(std::vector<absl::optional<GetPinsResult>> result);
   void OnPinsRemovedResult(absl::optional<RemovePinResult> result);
+  void Finish(bool result);
 
   raw_ptr<PrefService> prefs_service_;
   raw_ptr<IpfsService> ipfs_service_;
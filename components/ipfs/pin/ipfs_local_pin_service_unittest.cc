@@ -8,7 +8,9 @@
 #include <memory>
 #include <set>
 #include <utility>
+#include <vector>
 
+#include "base/containers/contains.h"
 #include "base/json/json_reader.h"
 #include "base/test/bind.h"
 #include "brave/components/ipfs/ipfs_service.h"
@@ -243,6 +245,107 @@ TEST_F(IpfsLocalPinServiceTest, AddLocalPinJobTest) {
   }
 }
 
+TEST_F(IpfsLocalPinServiceTest, MergedAddLocalPinJobTest) {
+  EXPECT_CALL(*GetIpfsService(), AddPin(_, _, _))
+      .Times(2)
+      .WillRepeatedly(::testing::Invoke(
+          [](const std::vector<std::string>& cids, bool recursive,
+             IpfsService::AddPinCallback callback) {
+            AddPinResult result;
+            for (const auto& cid : cids) {
+              result.pins.push_back(cid.substr(6));
+            }
+            result.recursive = recursive;
+            std::move(callback).Run(result);
+          }));
+
+  absl::optional<bool> first_success;
+  absl::optional<bool> second_success;
+  AddLocalPinJob job(
+      GetPrefs(), GetIpfsService(), "a",
+      {{"/ipfs/Qma", PinningMode::DIRECT},
+       {"/ipfs/Qma/1.json", PinningMode::RECURSIVE}},
+      base::BindLambdaForTesting(
+          [&first_success](bool result) { first_success = result; }));
+  AddLocalPinJob other_job(
+      GetPrefs(), GetIpfsService(), "b",
+      {{"/ipfs/Qma", PinningMode::DIRECT},
+       {"/ipfs/Qma/2.json", PinningMode::RECURSIVE},
+       {"/ipfs/Qmb", PinningMode::RECURSIVE}},
+      base::BindLambdaForTesting(
+          [&second_success](bool result) { second_success = result; }));
+  EXPECT_TRUE(job.MergeWith(&other_job));
+  job.Start();
+
+  std::string expected = R"({"recursive": {
+                              "Qma/1.json" : ["a"],
+                              "Qma/2.json" : ["b"],
+                              "Qmb" : ["b"]
+                           }, "direct": {
+                              "Qma" : ["a", "b"]
+                           }})";
+  absl::optional<base::Value> expected_value = base::JSONReader::Read(
+      expected, base::JSON_PARSE_CHROMIUM_EXTENSIONS |
+                    base::JSONParserOptions::JSON_PARSE_RFC);
+  EXPECT_EQ(expected_value.value(), GetPrefs()->GetDict(kIPFSPinnedCids));
+  EXPECT_TRUE(first_success.value());
+  EXPECT_TRUE(second_success.value());
+}
+
+TEST_F(IpfsLocalPinServiceTest, FailedMergedAddLocalPinJobIsSplit) {
+  size_t add_pin_calls = 0;
+  EXPECT_CALL(*GetIpfsService(), AddPin(_, _, _))
+      .WillRepeatedly(::testing::Invoke(
+          [&add_pin_calls](const std::vector<std::string>& cids,
+                           bool recursive,
+                           IpfsService::AddPinCallback callback) {
+            add_pin_calls++;
+            if (base::Contains(cids, "/ipfs/Qbad")) {
+              std::move(callback).Run(absl::nullopt);
+              return;
+            }
+            AddPinResult result;
+            for (const auto& cid : cids) {
+              result.pins.push_back(cid.substr(6));
+            }
+            result.recursive = recursive;
+            std::move(callback).Run(result);
+          }));
+
+  std::vector<absl::optional<bool>> results(3);
+  AddLocalPinJob job(GetPrefs(), GetIpfsService(), "a",
+                     {{"/ipfs/Qma", PinningMode::RECURSIVE}},
+                     base::BindLambdaForTesting(
+                         [&results](bool result) { results[0] = result; }));
+  AddLocalPinJob bad_job(GetPrefs(), GetIpfsService(), "b",
+                         {{"/ipfs/Qma", PinningMode::RECURSIVE},
+                          {"/ipfs/Qbad", PinningMode::RECURSIVE}},
+                         base::BindLambdaForTesting([&results](bool result) {
+                           results[1] = result;
+                         }));
+  AddLocalPinJob other_job(GetPrefs(), GetIpfsService(), "c",
+                           {{"/ipfs/Qmc", PinningMode::RECURSIVE}},
+                           base::BindLambdaForTesting([&results](bool result) {
+                             results[2] = result;
+                           }));
+  EXPECT_TRUE(job.MergeWith(&bad_job));
+  EXPECT_TRUE(job.MergeWith(&other_job));
+  job.Start();
+
+  // One merged pair of calls, then one pair per request.
+  EXPECT_EQ(add_pin_calls, 8u);
+  EXPECT_EQ(results, std::vector<absl::optional<bool>>({true, false, true}));
+
+  std::string expected = R"({"recursive": {
+                              "Qma" : ["a"],
+                              "Qmc" : ["c"]
+                           }, "direct": {}})";
+  absl::optional<base::Value> expected_value = base::JSONReader::Read(
+      expected, base::JSON_PARSE_CHROMIUM_EXTENSIONS |
+                    base::JSONParserOptions::JSON_PARSE_RFC);
+  EXPECT_EQ(expected_value.value(), GetPrefs()->GetDict(kIPFSPinnedCids));
+}
+
 TEST_F(IpfsLocalPinServiceTest, RemoveLocalPinJobTest) {
   {
     std::string base = R"({"recursive": {
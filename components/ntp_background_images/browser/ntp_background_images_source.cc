@@ -9,11 +9,9 @@
 #include <vector>
 
 #include "base/files/file_path.h"
-#include "base/files/file_util.h"
 #include "base/functional/bind.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/strings/stringprintf.h"
-#include "base/task/thread_pool.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_data.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "brave/components/ntp_background_images/browser/url_constants.h"
@@ -22,22 +20,9 @@
 
 namespace ntp_background_images {
 
-namespace {
-
-absl::optional<std::string> ReadFileToString(const base::FilePath& path) {
-  std::string contents;
-  if (!base::ReadFileToString(path, &contents))
-    return absl::optional<std::string>();
-  return contents;
-}
-
-}  // namespace
-
 NTPBackgroundImagesSource::NTPBackgroundImagesSource(
     NTPBackgroundImagesService* service)
-    : service_(service),
-      weak_factory_(this) {
-}
+    : service_(service) {}
 
 NTPBackgroundImagesSource::~NTPBackgroundImagesSource() = default;
 
@@ -62,32 +47,13 @@ void NTPBackgroundImagesSource::StartDataRequest(
     return;
   }
 
-  base::FilePath image_file_path =
-      images_data->backgrounds[GetWallpaperIndexFromPath(path)].image_file;
-
-  GetImageFile(image_file_path, std::move(callback));
-}
-
-void NTPBackgroundImagesSource::GetImageFile(
-    const base::FilePath& image_file_path,
-    GotDataCallback callback) {
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&ReadFileToString, image_file_path),
-      base::BindOnce(&NTPBackgroundImagesSource::OnGotImageFile,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
-}
-
-void NTPBackgroundImagesSource::OnGotImageFile(
-    GotDataCallback callback,
-    absl::optional<std::string> input) {
-  if (!input)
-    return;
+  const auto& backgrounds = images_data->backgrounds;
+  image_cache_.GetImage(backgrounds[index].image_file, std::move(callback));
 
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-       reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
-  std::move(callback).Run(std::move(bytes));
+  // ViewCounterModel shows the wallpapers in order, so the next tab will most
+  // likely ask for the next one.
+  const size_t next_index = (index + 1) % backgrounds.size();
+  image_cache_.Prefetch(backgrounds[next_index].image_file);
 }
 
 std::string NTPBackgroundImagesSource::GetMimeType(const GURL& url) {
@@ -9,13 +9,8 @@
 #include <string>
 
 #include "base/memory/raw_ptr.h"
-#include "base/memory/weak_ptr.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
 #include "content/public/browser/url_data_source.h"
-#include "third_party/abseil-cpp/absl/types/optional.h"
-
-namespace base {
-class FilePath;
-}  // namespace base
 
 namespace ntp_background_images {
 
@@ -44,14 +39,12 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
                         GotDataCallback callback) override;
   std::string GetMimeType(const GURL& url) override;
 
-  void GetImageFile(const base::FilePath& image_file_path,
-                    GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
-                      absl::optional<std::string> input);
   int GetWallpaperIndexFromPath(const std::string& path) const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;  // not owned
-  base::WeakPtrFactory<NTPBackgroundImagesSource> weak_factory_;
+  // Holds the current wallpaper and the next one, which is read ahead as
+  // wallpapers are shown in order.
+  NTPImageFileCache image_cache_{2};
 };
 
 }  // namespace ntp_background_images
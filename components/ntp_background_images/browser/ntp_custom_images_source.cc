@@ -69,12 +69,8 @@ void NTPCustomImagesSource::GetImageFile(const base::FilePath& image_file_path,
 }
 
 void NTPCustomImagesSource::OnGotImageFile(GotDataCallback callback,
-                                           const std::string& input) {
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-      reinterpret_cast<const unsigned char*>(input.c_str()), input.length());
-  std::move(callback).Run(std::move(bytes));
-  return;
+                                           std::string input) {
+  std::move(callback).Run(base::RefCountedString::TakeString(&input));
 }
 
 }  // namespace ntp_background_images
@@ -41,7 +41,7 @@ class NTPCustomImagesSource : public content::URLDataSource {
 
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback, const std::string& input);
+  void OnGotImageFile(GotDataCallback callback, std::string input);
 
   raw_ptr<BraveNTPCustomBackgroundService> service_ = nullptr;  // not owned
   base::WeakPtrFactory<NTPCustomImagesSource> weak_factory_;
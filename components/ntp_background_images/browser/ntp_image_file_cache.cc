@@ -0,0 +1,89 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
+
+#include <utility>
+
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/task/thread_pool.h"
+#include "base/trace_event/trace_event.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+absl::optional<std::string> ReadFileToString(const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return absl::optional<std::string>();
+  return contents;
+}
+
+}  // namespace
+
+NTPImageFileCache::NTPImageFileCache(size_t max_size) : cache_(max_size) {}
+
+NTPImageFileCache::~NTPImageFileCache() = default;
+
+void NTPImageFileCache::GetImage(const base::FilePath& path,
+                                 GetImageCallback callback) {
+  if (auto it = cache_.Get(path); it != cache_.end()) {
+    TRACE_EVENT_INSTANT1("brave", "NTPImageFileCache::Hit",
+                         TRACE_EVENT_SCOPE_THREAD, "bytes", it->second->size());
+    std::move(callback).Run(it->second);
+    return;
+  }
+
+  // Joins the read that is already in flight, possibly a prefetch.
+  if (auto it = pending_reads_.find(path); it != pending_reads_.end()) {
+    it->second.push_back(std::move(callback));
+    return;
+  }
+
+  pending_reads_[path].push_back(std::move(callback));
+  ReadImage(path);
+}
+
+void NTPImageFileCache::Prefetch(const base::FilePath& path) {
+  if (path.empty() || cache_.Peek(path) != cache_.end() ||
+      pending_reads_.contains(path)) {
+    return;
+  }
+
+  pending_reads_[path];
+  ReadImage(path);
+}
+
+void NTPImageFileCache::ReadImage(const base::FilePath& path) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ReadFileToString, path),
+      base::BindOnce(&NTPImageFileCache::OnImageRead,
+                     weak_factory_.GetWeakPtr(), path));
+}
+
+void NTPImageFileCache::OnImageRead(const base::FilePath& path,
+                                    absl::optional<std::string> contents) {
+  auto it = pending_reads_.find(path);
+  DCHECK(it != pending_reads_.end());
+  auto callbacks = std::move(it->second);
+  pending_reads_.erase(it);
+
+  scoped_refptr<base::RefCountedMemory> image;
+  if (contents) {
+    bytes_read_ += contents->size();
+    TRACE_EVENT_INSTANT1("brave", "NTPImageFileCache::Read",
+                         TRACE_EVENT_SCOPE_THREAD, "bytes", contents->size());
+    image = base::RefCountedString::TakeString(&*contents);
+    cache_.Put(path, image);
+  }
+
+  for (auto& callback : callbacks)
+    std::move(callback).Run(image);
+}
+
+}  // namespace ntp_background_images
@@ -0,0 +1,62 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace ntp_background_images {
+
+// Keeps the most recently served images in memory and reads the images that
+// are about to be shown ahead of time, so a new tab doesn't have to wait for
+// its full resolution wallpaper to be read from disk.
+// Concurrent requests for the same file share a single read.
+class NTPImageFileCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  explicit NTPImageFileCache(size_t max_size);
+  ~NTPImageFileCache();
+
+  NTPImageFileCache(const NTPImageFileCache&) = delete;
+  NTPImageFileCache& operator=(const NTPImageFileCache&) = delete;
+
+  // Runs |callback| with the contents of |path|, or with nullptr if it can't
+  // be read. Cached images are passed synchronously.
+  void GetImage(const base::FilePath& path, GetImageCallback callback);
+  // Reads |path| into the cache unless it's already there.
+  void Prefetch(const base::FilePath& path);
+
+  // Bytes read from disk so far.
+  size_t bytes_read() const { return bytes_read_; }
+
+ private:
+  void ReadImage(const base::FilePath& path);
+  void OnImageRead(const base::FilePath& path,
+                   absl::optional<std::string> contents);
+
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>> cache_;
+  // Callbacks waiting for a read to finish. The list is empty for prefetches.
+  base::flat_map<base::FilePath, std::vector<GetImageCallback>> pending_reads_;
+  size_t bytes_read_ = 0;
+
+  base::WeakPtrFactory<NTPImageFileCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
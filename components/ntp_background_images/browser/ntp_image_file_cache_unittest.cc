@@ -0,0 +1,98 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPImageFileCacheTest : public testing::Test {
+ public:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath WriteImage(const std::string& name,
+                            const std::string& contents) {
+    base::FilePath path = temp_dir_.GetPath().AppendASCII(name);
+    EXPECT_TRUE(base::WriteFile(path, contents));
+    return path;
+  }
+
+  // Returns the image contents, or absl::nullopt if it couldn't be read.
+  absl::optional<std::string> GetImage(NTPImageFileCache* cache,
+                                       const base::FilePath& path) {
+    absl::optional<std::string> result;
+    base::RunLoop run_loop;
+    cache->GetImage(path, base::BindLambdaForTesting(
+                              [&](scoped_refptr<base::RefCountedMemory> data) {
+                                if (data)
+                                  result.emplace(data->front_as<char>(),
+                                                 data->size());
+                                run_loop.Quit();
+                              }));
+    run_loop.Run();
+    return result;
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(NTPImageFileCacheTest, ServesCachedImagesFromMemory) {
+  NTPImageFileCache cache(2);
+  const base::FilePath image = WriteImage("image.jpg", "image data");
+
+  EXPECT_EQ("image data", GetImage(&cache, image));
+  EXPECT_EQ(10u, cache.bytes_read());
+
+  // The second request doesn't read the file again.
+  EXPECT_EQ("image data", GetImage(&cache, image));
+  EXPECT_EQ(10u, cache.bytes_read());
+}
+
+TEST_F(NTPImageFileCacheTest, Prefetch) {
+  NTPImageFileCache cache(2);
+  const base::FilePath image = WriteImage("image.jpg", "image data");
+
+  cache.Prefetch(image);
+  // Requests made while the prefetch is in flight share its read.
+  EXPECT_EQ("image data", GetImage(&cache, image));
+  EXPECT_EQ(10u, cache.bytes_read());
+
+  cache.Prefetch(image);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(10u, cache.bytes_read());
+}
+
+TEST_F(NTPImageFileCacheTest, EvictsLeastRecentlyUsedImage) {
+  NTPImageFileCache cache(1);
+  const base::FilePath first = WriteImage("first.jpg", "first");
+  const base::FilePath second = WriteImage("second.jpg", "second");
+
+  EXPECT_EQ("first", GetImage(&cache, first));
+  EXPECT_EQ("second", GetImage(&cache, second));
+  EXPECT_EQ("first", GetImage(&cache, first));
+  EXPECT_EQ(16u, cache.bytes_read());
+}
+
+TEST_F(NTPImageFileCacheTest, MissingFile) {
+  NTPImageFileCache cache(2);
+  const base::FilePath missing = temp_dir_.GetPath().AppendASCII("missing");
+
+  EXPECT_FALSE(GetImage(&cache, missing));
+  // Failures are not cached.
+  WriteImage("missing", "found");
+  EXPECT_EQ("found", GetImage(&cache, missing));
+}
+
+}  // namespace ntp_background_images
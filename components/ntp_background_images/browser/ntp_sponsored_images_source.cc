@@ -9,11 +9,9 @@
 #include <vector>
 
 #include "base/files/file_path.h"
-#include "base/files/file_util.h"
 #include "base/functional/bind.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/strings/stringprintf.h"
-#include "base/task/thread_pool.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_images_data.h"
 #include "brave/components/ntp_background_images/browser/url_constants.h"
@@ -24,13 +22,6 @@ namespace ntp_background_images {
 
 namespace {
 
-absl::optional<std::string> ReadFileToString(const base::FilePath& path) {
-  std::string contents;
-  if (!base::ReadFileToString(path, &contents))
-    return absl::optional<std::string>();
-  return contents;
-}
-
 bool IsSuperReferralPath(const std::string& path) {
   return path.rfind(kSuperReferralPath, 0) == 0;
 }
@@ -39,7 +30,7 @@ bool IsSuperReferralPath(const std::string& path) {
 
 NTPSponsoredImagesSource::NTPSponsoredImagesSource(
     NTPBackgroundImagesService* service)
-    : service_(service), weak_factory_(this) {}
+    : service_(service) {}
 
 NTPSponsoredImagesSource::~NTPSponsoredImagesSource() = default;
 
@@ -70,29 +61,8 @@ void NTPSponsoredImagesSource::StartDataRequest(
     return;
   }
 
-  GetImageFile(image_file_path, std::move(callback));
-}
-
-void NTPSponsoredImagesSource::GetImageFile(
-    const base::FilePath& image_file_path,
-    GotDataCallback callback) {
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&ReadFileToString, image_file_path),
-      base::BindOnce(&NTPSponsoredImagesSource::OnGotImageFile,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
-}
-
-void NTPSponsoredImagesSource::OnGotImageFile(
-    GotDataCallback callback,
-    absl::optional<std::string> input) {
-  if (!input)
-    return;
-
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-      reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
-  std::move(callback).Run(std::move(bytes));
+  image_cache_.GetImage(image_file_path, std::move(callback));
+  image_cache_.Prefetch(GetNextWallpaperFilePathFor(path, image_file_path));
 }
 
 std::string NTPSponsoredImagesSource::GetMimeType(const GURL& url) {
@@ -151,6 +121,26 @@ base::FilePath NTPSponsoredImagesSource::GetLocalFilePathFor(
   return base::FilePath();
 }
 
+base::FilePath NTPSponsoredImagesSource::GetNextWallpaperFilePathFor(
+    const std::string& path,
+    const base::FilePath& image_file_path) {
+  auto* images_data =
+      service_->GetBrandedImagesData(IsSuperReferralPath(path));
+  if (!images_data)
+    return base::FilePath();
+
+  // Branded wallpapers of a campaign are shown in order.
+  for (const auto& campaign : images_data->campaigns) {
+    const auto& backgrounds = campaign.backgrounds;
+    for (size_t i = 0; i < backgrounds.size(); ++i) {
+      if (backgrounds[i].image_file == image_file_path)
+        return backgrounds[(i + 1) % backgrounds.size()].image_file;
+    }
+  }
+
+  return base::FilePath();
+}
+
 bool NTPSponsoredImagesSource::IsValidPath(const std::string& path) const {
   const bool is_super_referral_path = IsSuperReferralPath(path);
   auto* images_data = service_->GetBrandedImagesData(is_super_referral_path);
@@ -9,9 +9,8 @@
 #include <string>
 
 #include "base/memory/raw_ptr.h"
-#include "base/memory/weak_ptr.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
 #include "content/public/browser/url_data_source.h"
-#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace base {
 class FilePath;
@@ -45,14 +44,16 @@ class NTPSponsoredImagesSource : public content::URLDataSource {
   bool AllowCaching() override;
 
   base::FilePath GetLocalFilePathFor(const std::string& path);
-  void GetImageFile(const base::FilePath& image_file_path,
-                    GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
-                      absl::optional<std::string> input);
+  // Returns the wallpaper shown after |image_file_path| in its campaign, or
+  // an empty path if |image_file_path| isn't a wallpaper.
+  base::FilePath GetNextWallpaperFilePathFor(
+      const std::string& path,
+      const base::FilePath& image_file_path);
   bool IsValidPath(const std::string& path) const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;  // not owned
-  base::WeakPtrFactory<NTPSponsoredImagesSource> weak_factory_;
+  // Holds the logo, the current wallpaper and the next one of its campaign.
+  NTPImageFileCache image_cache_{3};
 };
 
 }  // namespace ntp_background_images
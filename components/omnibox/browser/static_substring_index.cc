@@ -0,0 +1,104 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/static_substring_index.h"
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "base/ranges/algorithm.h"
+
+namespace {
+
+// Queries up to this length occur in a large part of the strings, so the
+// suffix range is about as large as the index. Scanning the strings in list
+// order lets them stop as soon as |max_matches| strings are found instead.
+constexpr size_t kMaxLinearScanQueryLength = 2;
+
+}  // namespace
+
+StaticSubstringIndex::StaticSubstringIndex(
+    const std::vector<std::string>& strings) {
+  size_t size = 0;
+  for (const auto& string : strings)
+    size += string.size() + 1;
+  CHECK_LT(size, static_cast<size_t>(UINT32_MAX));
+  text_.reserve(size);
+  starts_.reserve(strings.size());
+  suffixes_.reserve(size - strings.size());
+  for (const auto& string : strings) {
+    DCHECK_EQ(string.find('\0'), std::string::npos);
+    const uint32_t start = static_cast<uint32_t>(text_.size());
+    starts_.push_back(start);
+    for (size_t i = 0; i < string.size(); ++i)
+      suffixes_.push_back(start + i);
+    text_.append(string);
+    text_.push_back('\0');
+  }
+  base::ranges::sort(suffixes_, [this](uint32_t lhs, uint32_t rhs) {
+    return SuffixAt(lhs) < SuffixAt(rhs);
+  });
+}
+
+StaticSubstringIndex::~StaticSubstringIndex() = default;
+
+base::StringPiece StaticSubstringIndex::SuffixAt(uint32_t offset) const {
+  // |text_| is '\0' terminated and every string ends with one.
+  return base::StringPiece(text_.data() + offset);
+}
+
+std::vector<StaticSubstringIndex::Match> StaticSubstringIndex::FindMatches(
+    base::StringPiece query,
+    size_t max_matches) const {
+  std::vector<Match> matches;
+  if (query.empty() || max_matches == 0 ||
+      query.find('\0') != base::StringPiece::npos) {
+    return matches;
+  }
+
+  if (query.size() <= kMaxLinearScanQueryLength) {
+    for (size_t index = 0;
+         index < starts_.size() && matches.size() < max_matches; ++index) {
+      const size_t position = SuffixAt(starts_[index]).find(query);
+      if (position != base::StringPiece::npos)
+        matches.push_back({index, position});
+    }
+    return matches;
+  }
+
+  // All suffixes starting with |query| form one contiguous range.
+  const auto prefix = [this, &query](uint32_t offset) {
+    return SuffixAt(offset).substr(0, query.size());
+  };
+  const auto begin = std::lower_bound(
+      suffixes_.begin(), suffixes_.end(), query,
+      [&prefix](uint32_t offset, base::StringPiece value) {
+        return prefix(offset) < value;
+      });
+  const auto end = std::upper_bound(
+      begin, suffixes_.end(), query,
+      [&prefix](base::StringPiece value, uint32_t offset) {
+        return value < prefix(offset);
+      });
+
+  for (auto it = begin; it != end; ++it) {
+    const auto string = std::upper_bound(starts_.begin(), starts_.end(), *it);
+    DCHECK(string != starts_.begin());
+    const size_t index = std::distance(starts_.begin(), string) - 1;
+    matches.push_back({index, *it - starts_[index]});
+  }
+
+  // Restore the order of the list, keeping the first occurrence in every
+  // string.
+  base::ranges::sort(matches, [](const Match& lhs, const Match& rhs) {
+    return lhs.index < rhs.index ||
+           (lhs.index == rhs.index && lhs.position < rhs.position);
+  });
+  matches.erase(base::ranges::unique(matches, {}, &Match::index),
+                matches.end());
+  if (matches.size() > max_matches)
+    matches.resize(max_matches);
+  return matches;
+}
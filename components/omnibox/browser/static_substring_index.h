@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_STATIC_SUBSTRING_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_STATIC_SUBSTRING_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+
+// Immutable suffix array over a fixed list of strings, for providers that
+// suggest from a static candidate set. It is built once and answers
+// substring queries with two binary searches instead of scanning every
+// candidate on each keystroke.
+class StaticSubstringIndex {
+ public:
+  struct Match {
+    // Index of the matching string in the list the index was built from.
+    size_t index;
+    // Offset of the first occurrence of the query in that string.
+    size_t position;
+  };
+
+  explicit StaticSubstringIndex(const std::vector<std::string>& strings);
+  ~StaticSubstringIndex();
+
+  StaticSubstringIndex(const StaticSubstringIndex&) = delete;
+  StaticSubstringIndex& operator=(const StaticSubstringIndex&) = delete;
+
+  // Returns up to |max_matches| strings containing |query|, in the order of
+  // the original list. An empty query matches nothing.
+  std::vector<Match> FindMatches(base::StringPiece query,
+                                 size_t max_matches) const;
+
+ private:
+  // Returns the suffix of |text_| starting at |offset|, up to the end of
+  // the string it belongs to.
+  base::StringPiece SuffixAt(uint32_t offset) const;
+
+  // All strings, each one terminated by a '\0'.
+  std::string text_;
+  // Offset of every string in |text_|, ascending.
+  std::vector<uint32_t> starts_;
+  // Offsets of all suffixes of all strings, sorted lexicographically.
+  std::vector<uint32_t> suffixes_;
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_STATIC_SUBSTRING_INDEX_H_
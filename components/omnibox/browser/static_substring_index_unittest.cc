@@ -0,0 +1,104 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/static_substring_index.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+std::vector<size_t> Indices(
+    const std::vector<StaticSubstringIndex::Match>& matches) {
+  std::vector<size_t> result;
+  for (const auto& match : matches)
+    result.push_back(match.index);
+  return result;
+}
+
+}  // namespace
+
+TEST(StaticSubstringIndexTest, FindMatches) {
+  StaticSubstringIndex index(
+      {"google.com", "mail.google.com", "yahoo.com", "", "google.co.in"});
+
+  auto matches = index.FindMatches("google", 10);
+  EXPECT_EQ(Indices(matches), (std::vector<size_t>{0, 1, 4}));
+  EXPECT_EQ(matches[0].position, 0u);
+  EXPECT_EQ(matches[1].position, 5u);
+  EXPECT_EQ(matches[2].position, 0u);
+
+  // Results keep the order of the list and are capped.
+  EXPECT_EQ(Indices(index.FindMatches(".co", 2)),
+            (std::vector<size_t>{0, 1}));
+
+  // Only the first occurrence in a string is reported.
+  matches = index.FindMatches("o", 10);
+  EXPECT_EQ(Indices(matches), (std::vector<size_t>{0, 1, 2, 4}));
+  EXPECT_EQ(matches[1].position, 6u);
+  EXPECT_EQ(matches[2].position, 3u);
+
+  // Queries don't match across the strings.
+  EXPECT_TRUE(index.FindMatches("commail", 10).empty());
+  EXPECT_TRUE(index.FindMatches("bing", 10).empty());
+  EXPECT_TRUE(index.FindMatches("", 10).empty());
+  EXPECT_TRUE(index.FindMatches("google", 0).empty());
+  EXPECT_TRUE(index.FindMatches(base::StringPiece("a\0m", 3), 10).empty());
+}
+
+TEST(StaticSubstringIndexTest, TruncatesInListOrder) {
+  StaticSubstringIndex index(
+      {"zab", "abcz", "b", "cab", "xyz", "ab", "bab", "abca"});
+
+  // Both short and long queries keep the first strings of the list, not the
+  // ones with the lexicographically smallest suffixes.
+  auto matches = index.FindMatches("b", 3);
+  EXPECT_EQ(Indices(matches), (std::vector<size_t>{0, 1, 2}));
+  EXPECT_EQ(matches[0].position, 2u);
+  EXPECT_EQ(matches[1].position, 1u);
+  EXPECT_EQ(matches[2].position, 0u);
+
+  matches = index.FindMatches("ab", 2);
+  EXPECT_EQ(Indices(matches), (std::vector<size_t>{0, 1}));
+  EXPECT_EQ(matches[0].position, 1u);
+  EXPECT_EQ(matches[1].position, 0u);
+
+  matches = index.FindMatches("bab", 1);
+  EXPECT_EQ(Indices(matches), (std::vector<size_t>{6}));
+  EXPECT_EQ(matches[0].position, 0u);
+
+  EXPECT_EQ(Indices(index.FindMatches("ab", 10)),
+            (std::vector<size_t>{0, 1, 3, 5, 6, 7}));
+  // "abca" sorts before "abcz" in the suffix array.
+  EXPECT_EQ(Indices(index.FindMatches("abc", 1)), (std::vector<size_t>{1}));
+}
+
+TEST(StaticSubstringIndexTest, SameAsLinearScan) {
+  std::vector<std::string> strings;
+  for (int i = 0; i < 200; ++i) {
+    std::string string;
+    for (int j = 0; j < 3 + i % 7; ++j)
+      string.push_back('a' + (i * 7 + j * 3) % 5);
+    strings.push_back(string);
+  }
+  StaticSubstringIndex index(strings);
+
+  for (const char* query : {"a", "ab", "bca", "eda", "ccc", "abcde", "z"}) {
+    std::vector<StaticSubstringIndex::Match> expected;
+    for (size_t i = 0; i < strings.size() && expected.size() < 25; ++i) {
+      const size_t position = strings[i].find(query);
+      if (position != std::string::npos)
+        expected.push_back({i, position});
+    }
+    const auto matches = index.FindMatches(query, 25);
+    ASSERT_EQ(matches.size(), expected.size()) << query;
+    for (size_t i = 0; i < matches.size(); ++i) {
+      EXPECT_EQ(matches[i].index, expected[i].index) << query;
+      EXPECT_EQ(matches[i].position, expected[i].position) << query;
+    }
+  }
+}
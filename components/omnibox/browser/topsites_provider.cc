@@ -10,9 +10,11 @@
 #include <algorithm>
 #include <string>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/omnibox/browser/brave_omnibox_prefs.h"
+#include "brave/components/omnibox/browser/static_substring_index.h"
 #include "components/omnibox/browser/autocomplete_input.h"
 #include "components/omnibox/browser/history_provider.h"
 #include "components/prefs/pref_service.h"
@@ -42,16 +44,12 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
   const std::string input_text =
       base::ToLowerASCII(base::UTF16ToUTF8(input.text()));
 
-  for (std::vector<std::string>::const_iterator i = top_sites_.begin();
-       (i != top_sites_.end()) && (matches_.size() < provider_max_matches());
-       ++i) {
-    const std::string &current_site = *i;
-    size_t foundPos = current_site.find(input_text);
-    if (std::string::npos != foundPos) {
-      ACMatchClassifications styles =
-          StylesForSingleMatch(input_text, current_site, foundPos);
-      AddMatch(base::ASCIIToUTF16(current_site), styles);
-    }
+  for (const auto& match :
+       GetTopSitesIndex().FindMatches(input_text, provider_max_matches())) {
+    const std::string& current_site = top_sites_[match.index];
+    ACMatchClassifications styles =
+        StylesForSingleMatch(input_text, current_site, match.position);
+    AddMatch(base::ASCIIToUTF16(current_site), styles);
   }
 
   for (size_t i = 0; i < matches_.size(); ++i) {
@@ -70,6 +68,12 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
 
 TopSitesProvider::~TopSitesProvider() = default;
 
+// static
+const StaticSubstringIndex& TopSitesProvider::GetTopSitesIndex() {
+  static const base::NoDestructor<StaticSubstringIndex> index(top_sites_);
+  return *index;
+}
+
 // static
 ACMatchClassifications TopSitesProvider::StylesForSingleMatch(
     const std::string &input_text,
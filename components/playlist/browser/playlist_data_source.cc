@@ -8,8 +8,10 @@
 #include <memory>
 #include <utility>
 
+#include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/files/memory_mapped_file.h"
 #include "base/functional/bind.h"
 #include "base/location.h"
 #include "base/memory/ref_counted_memory.h"
@@ -23,6 +25,34 @@ namespace playlist {
 
 namespace {
 
+// Exposes a memory mapped file as RefCountedMemory. Pages are only read from
+// disk when they are touched, so serving a range of a large media file
+// doesn't read the rest of it.
+class RefCountedMemoryMappedFile : public base::RefCountedMemory {
+ public:
+  explicit RefCountedMemoryMappedFile(
+      std::unique_ptr<base::MemoryMappedFile> mapped_file)
+      : mapped_file_(std::move(mapped_file)) {}
+
+  RefCountedMemoryMappedFile(const RefCountedMemoryMappedFile&) = delete;
+  RefCountedMemoryMappedFile& operator=(const RefCountedMemoryMappedFile&) =
+      delete;
+
+  // base::RefCountedMemory:
+  const unsigned char* front() const override { return mapped_file_->data(); }
+  size_t size() const override { return mapped_file_->length(); }
+
+ private:
+  ~RefCountedMemoryMappedFile() override {
+    // The last reference can be dropped on a thread that disallows blocking,
+    // while closing the file may block.
+    base::ThreadPool::CreateSequencedTaskRunner({base::MayBlock()})
+        ->DeleteSoon(FROM_HERE, std::move(mapped_file_));
+  }
+
+  std::unique_ptr<base::MemoryMappedFile> mapped_file_;
+};
+
 scoped_refptr<base::RefCountedMemory> ReadFileToString(
     const base::FilePath& path) {
   std::string contents;
@@ -31,9 +61,30 @@ scoped_refptr<base::RefCountedMemory> ReadFileToString(
     return nullptr;
   }
 
-  return base::MakeRefCounted<base::RefCountedBytes>(
-      reinterpret_cast<const unsigned char*>(contents.c_str()),
-      contents.length());
+  return base::RefCountedString::TakeString(&contents);
+}
+
+scoped_refptr<base::RefCountedMemory> MapFile(const base::FilePath& path) {
+  // Allow the item to be removed while its media is being played.
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ |
+                            base::File::FLAG_WIN_SHARE_DELETE);
+  if (!file.IsValid()) {
+    VLOG(2) << __FUNCTION__ << " Failed to open " << path;
+    return nullptr;
+  }
+
+  // Mapping an empty file fails.
+  if (file.GetLength() == 0)
+    return base::MakeRefCounted<base::RefCountedString>();
+
+  auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+  if (!mapped_file->Initialize(std::move(file))) {
+    VLOG(2) << __FUNCTION__ << " Failed to map " << path;
+    return nullptr;
+  }
+
+  return base::MakeRefCounted<RefCountedMemoryMappedFile>(
+      std::move(mapped_file));
 }
 
 }  // namespace
@@ -71,6 +122,7 @@ void PlaylistDataSource::StartDataRequest(
   }
 
   base::FilePath data_path;
+  bool is_media = false;
   if (type_string == "thumbnail") {
     if (!service_->GetThumbnailPath(id, &data_path)) {
       std::move(got_data_callback).Run(nullptr);
@@ -81,19 +133,25 @@ void PlaylistDataSource::StartDataRequest(
       std::move(got_data_callback).Run(nullptr);
       return;
     }
+    is_media = true;
   } else {
     NOTREACHED() << "type is neither of {thumbnail,media}/ : " << type_string;
     std::move(got_data_callback).Run(nullptr);
     return;
   }
 
-  GetDataFile(data_path, std::move(got_data_callback));
+  GetDataFile(data_path, is_media, std::move(got_data_callback));
 }
 
 void PlaylistDataSource::GetDataFile(const base::FilePath& data_path,
+                                     bool is_media,
                                      GotDataCallback got_data_callback) {
+  // Media files can be hundreds of megabytes while the player only asks for
+  // a range at a time. The WebUI loader copies just the requested range out
+  // of the data, so map the file instead of reading all of it upfront.
   base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, base::MayBlock(), base::BindOnce(&ReadFileToString, data_path),
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(is_media ? &MapFile : &ReadFileToString, data_path),
       base::BindOnce(&PlaylistDataSource::OnGotDataFile,
                      weak_factory_.GetWeakPtr(), std::move(got_data_callback)));
 }
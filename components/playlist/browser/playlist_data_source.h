@@ -42,6 +42,7 @@ class PlaylistDataSource : public content::URLDataSource {
 
  private:
   void GetDataFile(const base::FilePath& data_path,
+                   bool is_media,
                    GotDataCallback got_data_callback);
   void OnGotDataFile(GotDataCallback got_data_callback,
                      scoped_refptr<base::RefCountedMemory> input);
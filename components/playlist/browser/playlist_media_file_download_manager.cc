@@ -5,13 +5,16 @@
 
 #include "brave/components/playlist/browser/playlist_media_file_download_manager.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/files/file_path.h"
 #include "base/logging.h"
+#include "base/ranges/algorithm.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/playlist/browser/playlist_constants.h"
+#include "brave/components/playlist/common/features.h"
 
 namespace playlist {
 
@@ -31,11 +34,24 @@ PlaylistMediaFileDownloadManager::PlaylistMediaFileDownloadManager(
     content::BrowserContext* context,
     Delegate* delegate,
     const base::FilePath& base_dir)
-    : base_dir_(base_dir), delegate_(delegate) {
+    : PlaylistMediaFileDownloadManager(
+          context,
+          delegate,
+          base_dir,
+          static_cast<size_t>(std::max(
+              1, features::kPlaylistMaxConcurrentMediaDownloads.Get()))) {}
+
+PlaylistMediaFileDownloadManager::PlaylistMediaFileDownloadManager(
+    content::BrowserContext* context,
+    Delegate* delegate,
+    const base::FilePath& base_dir,
+    size_t max_concurrent_downloads)
+    : context_(context),
+      base_dir_(base_dir),
+      delegate_(delegate),
+      max_concurrent_downloads_(max_concurrent_downloads) {
   DCHECK(delegate_) << "We don't consider where |delegate| is null";
-  // TODO(pilgrim) dynamically set file extensions based on format.
-  media_file_downloader_ = std::make_unique<PlaylistMediaFileDownloader>(
-      this, context, kMediaFileName);
+  DCHECK_GT(max_concurrent_downloads_, 0u);
 }
 
 PlaylistMediaFileDownloadManager::~PlaylistMediaFileDownloadManager() = default;
@@ -45,54 +61,75 @@ void PlaylistMediaFileDownloadManager::DownloadMediaFile(
   DCHECK(request);
   DCHECK(request->item);
 
-  pending_media_file_creation_jobs_.push(std::move(request));
+  pending_media_file_creation_jobs_.push_back(std::move(request));
 
-  // If either media file controller is generating a playlist media file,
-  // delay the next playlist generation. It will be triggered when the current
-  // one is finished.
-  if (!IsCurrentDownloadingInProgress())
-    TryStartingDownloadTask();
+  // If all downloaders are busy, the job waits in the queue. It will be
+  // started when one of the current downloads is finished.
+  TryStartingDownloadTasks();
 }
 
 void PlaylistMediaFileDownloadManager::CancelDownloadRequest(
     const std::string& id) {
   VLOG(2) << __func__ << " " << id;
 
-  // Cancel if currently downloading item is id.
-  // Otherwise, GetNextPlaylistItemTarget() will drop canceled one.
-  if (GetCurrentDownloadingPlaylistItemID() == id) {
-    CancelCurrentDownloadingPlaylistItem();
-    TryStartingDownloadTask();
-    return;
+  // Cancel if the item is being downloaded.
+  // Otherwise, PopNextJob() will drop canceled one.
+  if (current_jobs_.contains(id)) {
+    CancelDownloadingPlaylistItem(id);
+    TryStartingDownloadTasks();
   }
 }
 
 void PlaylistMediaFileDownloadManager::CancelAllDownloadRequests() {
-  CancelCurrentDownloadingPlaylistItem();
-  pending_media_file_creation_jobs_ = {};
+  for (auto& downloader : media_file_downloaders_)
+    downloader->RequestCancelCurrentPlaylistGeneration();
+  current_jobs_.clear();
+  pending_media_file_creation_jobs_.clear();
 }
 
-void PlaylistMediaFileDownloadManager::TryStartingDownloadTask() {
-  if (IsCurrentDownloadingInProgress())
-    return;
+void PlaylistMediaFileDownloadManager::TryStartingDownloadTasks() {
+  // Requests for items that are already being downloaded are set aside so
+  // that they don't hold up the jobs behind them.
+  base::circular_deque<std::unique_ptr<DownloadJob>> duplicated_jobs;
+  while (current_jobs_.size() < max_concurrent_downloads_) {
+    auto job = PopNextJob();
+    if (!job)
+      break;
+
+    DCHECK(job->item);
+    const std::string id = job->item->id;
+    if (current_jobs_.contains(id)) {
+      duplicated_jobs.push_back(std::move(job));
+      continue;
+    }
 
-  if (pending_media_file_creation_jobs_.empty())
-    return;
+    auto item = job->item.Clone();
+    current_jobs_.emplace(id, std::move(job));
 
-  current_job_ = PopNextJob();
-  if (!current_job_) {
-    return;
+    if (!pause_download_for_testing_) {
+      VLOG(2) << __func__ << ": " << item->name;
+      // This can finish the job synchronously, e.g. when the item is cached.
+      GetIdleDownloader()->DownloadMediaFileForPlaylistItem(item, base_dir_);
+    }
   }
 
-  DCHECK(current_job_->item);
-
-  if (!pause_download_for_testing_) {
-    VLOG(2) << __func__ << ": " << current_job_->item->name;
-    media_file_downloader_->DownloadMediaFileForPlaylistItem(current_job_->item,
-                                                             base_dir_);
+  // Keep the duplicated requests, in order, at the front of the queue until
+  // the current downloads of their items are done.
+  while (!duplicated_jobs.empty()) {
+    pending_media_file_creation_jobs_.push_front(
+        std::move(duplicated_jobs.back()));
+    duplicated_jobs.pop_back();
   }
 }
 
+void PlaylistMediaFileDownloadManager::ScheduleToStartDownloadTasks() {
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          &PlaylistMediaFileDownloadManager::TryStartingDownloadTasks,
+          weak_factory_.GetWeakPtr()));
+}
+
 std::unique_ptr<PlaylistMediaFileDownloadManager::DownloadJob>
 PlaylistMediaFileDownloadManager::PopNextJob() {
   while (!pending_media_file_creation_jobs_.empty()) {
@@ -100,7 +137,7 @@ PlaylistMediaFileDownloadManager::PopNextJob() {
     DCHECK(request);
     DCHECK(request->item);
 
-    pending_media_file_creation_jobs_.pop();
+    pending_media_file_creation_jobs_.pop_front();
 
     if (delegate_->IsValidPlaylistItem(request->item->id)) {
       return request;
@@ -110,21 +147,42 @@ PlaylistMediaFileDownloadManager::PopNextJob() {
   return {};
 }
 
-std::string
-PlaylistMediaFileDownloadManager::GetCurrentDownloadingPlaylistItemID() const {
-  if (IsCurrentDownloadingInProgress())
-    return media_file_downloader_->current_playlist_id();
+PlaylistMediaFileDownloader*
+PlaylistMediaFileDownloadManager::GetIdleDownloader() {
+  auto iter = base::ranges::find_if(
+      media_file_downloaders_,
+      [](const auto& downloader) { return !downloader->in_progress(); });
+  if (iter != media_file_downloaders_.end())
+    return iter->get();
 
-  return {};
+  DCHECK_LT(media_file_downloaders_.size(), max_concurrent_downloads_);
+  // TODO(pilgrim) dynamically set file extensions based on format.
+  media_file_downloaders_.push_back(
+      std::make_unique<PlaylistMediaFileDownloader>(this, context_,
+                                                    kMediaFileName));
+  return media_file_downloaders_.back().get();
 }
 
-void PlaylistMediaFileDownloadManager::CancelCurrentDownloadingPlaylistItem() {
-  media_file_downloader_->RequestCancelCurrentPlaylistGeneration();
-  current_job_.reset();
+void PlaylistMediaFileDownloadManager::CancelDownloadingPlaylistItem(
+    const std::string& id) {
+  for (auto& downloader : media_file_downloaders_) {
+    if (downloader->in_progress() && downloader->current_playlist_id() == id) {
+      downloader->RequestCancelCurrentPlaylistGeneration();
+      break;
+    }
+  }
+  current_jobs_.erase(id);
 }
 
-bool PlaylistMediaFileDownloadManager::IsCurrentDownloadingInProgress() const {
-  return media_file_downloader_->in_progress();
+std::unique_ptr<PlaylistMediaFileDownloadManager::DownloadJob>
+PlaylistMediaFileDownloadManager::TakeCurrentJob(const std::string& id) {
+  auto iter = current_jobs_.find(id);
+  if (iter == current_jobs_.end())
+    return nullptr;
+
+  auto job = std::move(iter->second);
+  current_jobs_.erase(iter);
+  return job;
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
@@ -133,18 +191,15 @@ void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
     int64_t received_bytes,
     int percent_complete,
     base::TimeDelta time_remaining) {
-  if (!current_job_ || !current_job_->item) {
+  auto iter = current_jobs_.find(id);
+  if (iter == current_jobs_.end() || !iter->second->item) {
     return;
   }
 
-  if (current_job_->item->id != id) {
-    return;
-  }
-
-  if (current_job_->on_progress_callback) {
-    current_job_->on_progress_callback.Run(current_job_->item, total_bytes,
-                                           received_bytes, percent_complete,
-                                           time_remaining);
+  const auto& job = iter->second;
+  if (job->on_progress_callback) {
+    job->on_progress_callback.Run(job->item, total_bytes, received_bytes,
+                                  percent_complete, time_remaining);
   }
 }
 
@@ -152,48 +207,32 @@ void PlaylistMediaFileDownloadManager::OnMediaFileReady(
     const std::string& id,
     const std::string& media_file_path) {
   VLOG(2) << __func__ << ": " << id << " is ready.";
-  if (!current_job_ || !current_job_->item) {
+  auto job = TakeCurrentJob(id);
+  if (!job || !job->item) {
     return;
   }
 
-  if (current_job_->item->id != id) {
-    return;
+  if (job->on_finish_callback) {
+    std::move(job->on_finish_callback)
+        .Run(std::move(job->item), media_file_path);
   }
 
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item), media_file_path);
-  }
-  current_job_.reset();
-
-  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE,
-      base::BindOnce(&PlaylistMediaFileDownloadManager::TryStartingDownloadTask,
-                     weak_factory_.GetWeakPtr()));
+  ScheduleToStartDownloadTasks();
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileGenerationFailed(
     const std::string& id) {
   VLOG(2) << __func__ << ": " << id;
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
-
-  if (current_job_->item && current_job_->item->id != id) {
+  auto job = TakeCurrentJob(id);
+  if (!job || !job->item) {
     return;
   }
 
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item), {});
+  if (job->on_finish_callback) {
+    std::move(job->on_finish_callback).Run(std::move(job->item), {});
   }
-  current_job_.reset();
-  CancelCurrentDownloadingPlaylistItem();
 
-  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE,
-      base::BindOnce(&PlaylistMediaFileDownloadManager::TryStartingDownloadTask,
-                     weak_factory_.GetWeakPtr()));
+  ScheduleToStartDownloadTasks();
 }
 
 }  // namespace playlist
@@ -8,8 +8,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
-#include "base/containers/queue.h"
+#include "base/containers/circular_deque.h"
+#include "base/containers/flat_map.h"
 #include "brave/components/playlist/browser/playlist_media_file_downloader.h"
 #include "brave/components/playlist/common/mojom/playlist.mojom.h"
 
@@ -20,9 +22,9 @@ class BrowserContext;
 namespace playlist {
 
 // Download youtube playlist item's audio/video media files.
-// This handles one request at once. So, it has pending queue.
-// And PlaylistMediaFileDownloader does file download task.
-// TODO(simonhong): Download multiple media files simultaneously.
+// Up to |max_concurrent_downloads| requests are handled at once, the rest
+// wait in the pending queue. Each PlaylistMediaFileDownloader does the file
+// download task of one request.
 class PlaylistMediaFileDownloadManager
     : public PlaylistMediaFileDownloader::Delegate {
  public:
@@ -65,6 +67,10 @@ class PlaylistMediaFileDownloadManager
   PlaylistMediaFileDownloadManager(content::BrowserContext* context,
                                    Delegate* delegate,
                                    const base::FilePath& base_dir);
+  PlaylistMediaFileDownloadManager(content::BrowserContext* context,
+                                   Delegate* delegate,
+                                   const base::FilePath& base_dir,
+                                   size_t max_concurrent_downloads);
   ~PlaylistMediaFileDownloadManager() override;
 
   PlaylistMediaFileDownloadManager(const PlaylistMediaFileDownloadManager&) =
@@ -76,10 +82,13 @@ class PlaylistMediaFileDownloadManager
   void CancelDownloadRequest(const std::string& id);
   void CancelAllDownloadRequests();
 
-  bool has_download_requests() const { return !!current_job_; }
+  bool has_download_requests() const { return !current_jobs_.empty(); }
 
  private:
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ResetAll);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ConcurrentMediaDownloads);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           DuplicatedMediaDownloadDoesNotBlockQueue);
 
   // PlaylistMediaFileDownloader::Delegate overrides:
   void OnMediaFileDownloadProgressed(const std::string& id,
@@ -91,19 +100,30 @@ class PlaylistMediaFileDownloadManager
                         const std::string& media_file_path) override;
   void OnMediaFileGenerationFailed(const std::string& id) override;
 
-  void TryStartingDownloadTask();
+  void TryStartingDownloadTasks();
+  void ScheduleToStartDownloadTasks();
   std::unique_ptr<DownloadJob> PopNextJob();
-  std::string GetCurrentDownloadingPlaylistItemID() const;
-  void CancelCurrentDownloadingPlaylistItem();
-  bool IsCurrentDownloadingInProgress() const;
+  // Returns a downloader that isn't working on any item, creating one if
+  // needed.
+  PlaylistMediaFileDownloader* GetIdleDownloader();
+  void CancelDownloadingPlaylistItem(const std::string& id);
+
+  // Removes and returns the job of |id| if it's being downloaded.
+  std::unique_ptr<DownloadJob> TakeCurrentJob(const std::string& id);
 
+  raw_ptr<content::BrowserContext> context_;
   const base::FilePath base_dir_;
   raw_ptr<Delegate> delegate_;
-  base::queue<std::unique_ptr<DownloadJob>> pending_media_file_creation_jobs_;
+  const size_t max_concurrent_downloads_;
+  base::circular_deque<std::unique_ptr<DownloadJob>>
+      pending_media_file_creation_jobs_;
 
-  std::unique_ptr<DownloadJob> current_job_;
+  // Jobs being downloaded, keyed by item id.
+  base::flat_map<std::string, std::unique_ptr<DownloadJob>> current_jobs_;
 
-  std::unique_ptr<PlaylistMediaFileDownloader> media_file_downloader_;
+  // At most |max_concurrent_downloads_| downloaders, created on demand.
+  std::vector<std::unique_ptr<PlaylistMediaFileDownloader>>
+      media_file_downloaders_;
 
   bool pause_download_for_testing_ = false;
 
@@ -139,7 +139,7 @@ void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
 
   if (item->cached) {
     DVLOG(2) << __func__ << ": media file is already downloaded";
-    NotifySucceed(current_item_->id, current_item_->media_path.spec());
+    NotifySucceed(item->id, item->media_path.spec());
     return;
   }
 
@@ -185,8 +185,9 @@ void PlaylistMediaFileDownloader::OnDownloadCreated(
 
 void PlaylistMediaFileDownloader::OnDownloadUpdated(
     download::DownloadItem* item) {
-  if (!current_item_) {
-    // Download could be already finished. This seems to be late async callback.
+  if (!current_item_ || item->GetGuid() != current_item_->id) {
+    // Download could be already finished or canceled. This seems to be late
+    // async callback.
     return;
   }
 
@@ -74,6 +74,8 @@ PlaylistService::PlaylistService(content::BrowserContext* context,
   // instead of deleting them.
   CleanUpMalformedPlaylistItems();
 
+  InitMediaSources();
+
   CleanUpOrphanedPlaylistItemDirs();
 }
 
@@ -127,27 +129,36 @@ bool PlaylistService::AddItemsToPlaylist(
     return false;
   }
 
-  auto playlist = ConvertValueToPlaylist(*target_playlist,
-                                         prefs_->GetDict(kPlaylistItemsPref));
+  // Only the ids are touched, so large playlists don't have their items
+  // converted for each addition.
+  base::Value::List* playlist_item_ids = FindPlaylistItemIds(*target_playlist);
+  DCHECK(playlist_item_ids);
+  std::vector<std::string> existing_ids;
+  existing_ids.reserve(playlist_item_ids->size());
+  for (const auto& id_value : *playlist_item_ids)
+    existing_ids.push_back(id_value.GetString());
+  base::flat_set<std::string> playlist_item_id_set(std::move(existing_ids));
+
+  ScopedDictPrefUpdate items_update(prefs_, kPlaylistItemsPref);
   for (const auto& new_item_id : item_ids) {
     // We're considering adding item to which it was belong as success.
-    if (base::ranges::find_if(playlist->items,
-                              [&new_item_id](const auto& item) {
-                                return item->id == new_item_id;
-                              }) != playlist->items.end()) {
+    if (!playlist_item_id_set.insert(new_item_id).second)
       continue;
-    }
 
     // Update the item's parent lists.
-    auto new_item = GetPlaylistItem(new_item_id);
-    new_item->parents.push_back(playlist_id);
-    UpdatePlaylistItemValue(new_item->id,
-                            base::Value(ConvertPlaylistItemToValue(new_item)));
+    base::Value::Dict* item_value = items_update->FindDict(new_item_id);
+    DCHECK(item_value) << "Couldn't find PlaylistItem with id: "
+                       << new_item_id;
+    if (!item_value)
+      continue;
 
-    playlist->items.push_back(std::move(new_item));
+    base::Value::List* parents = FindPlaylistItemParents(*item_value);
+    DCHECK(parents);
+    parents->Append(playlist_id);
+
+    playlist_item_ids->Append(new_item_id);
   }
 
-  playlists_update->Set(playlist_id, ConvertPlaylistToValue(playlist));
   return true;
 }
 
@@ -176,18 +187,16 @@ bool PlaylistService::RemoveItemFromPlaylist(const PlaylistId& playlist_id,
       return false;
     }
 
-    auto target_playlist = ConvertValueToPlaylist(
-        *playlist_value, prefs_->GetDict(kPlaylistItemsPref));
+    base::Value::List* playlist_item_ids = FindPlaylistItemIds(*playlist_value);
+    DCHECK(playlist_item_ids);
     auto it = base::ranges::find_if(
-        target_playlist->items,
-        [&item_id](const auto& item) { return item->id == *item_id; });
+        *playlist_item_ids,
+        [&item_id](const auto& id) { return id.GetString() == *item_id; });
     // Consider this as success since the item is already removed.
-    if (it == target_playlist->items.end())
+    if (it == playlist_item_ids->end())
       return true;
 
-    target_playlist->items.erase(it, it + 1);
-    playlists_update->Set(target_playlist_id,
-                          ConvertPlaylistToValue(target_playlist));
+    playlist_item_ids->erase(it);
   }
 
   // Try to remove |playlist_id| from item->parents or delete the this item
@@ -230,25 +239,23 @@ void PlaylistService::ReorderItemFromPlaylist(const std::string& playlist_id,
       playlists_update->FindDict(target_playlist_id);
   DCHECK(playlist_value) << " Playlist " << playlist_id << " not found";
 
-  auto target_playlist = ConvertValueToPlaylist(
-      *playlist_value, prefs_->GetDict(kPlaylistItemsPref));
-  DCHECK_GT(target_playlist->items.size(), static_cast<size_t>(position));
+  base::Value::List* playlist_item_ids = FindPlaylistItemIds(*playlist_value);
+  DCHECK(playlist_item_ids);
+  DCHECK_GT(playlist_item_ids->size(), static_cast<size_t>(position));
   auto it = base::ranges::find_if(
-      target_playlist->items,
-      [&item_id](const auto& item) { return item->id == item_id; });
-  DCHECK(it != target_playlist->items.end());
+      *playlist_item_ids,
+      [&item_id](const auto& id) { return id.GetString() == item_id; });
+  DCHECK(it != playlist_item_ids->end());
 
-  auto old_position = std::distance(target_playlist->items.begin(), it);
+  auto old_position = std::distance(playlist_item_ids->begin(), it);
   if (old_position == position)
     return;
 
   if (old_position < position) {
-    std::rotate(it, it + 1, target_playlist->items.begin() + position + 1);
+    std::rotate(it, it + 1, playlist_item_ids->begin() + position + 1);
   } else {
-    std::rotate(target_playlist->items.begin() + position, it, it + 1);
+    std::rotate(playlist_item_ids->begin() + position, it, it + 1);
   }
-  playlists_update->Set(target_playlist_id,
-                        ConvertPlaylistToValue(target_playlist));
 }
 
 bool PlaylistService::MoveItem(const PlaylistId& from,
@@ -277,23 +284,16 @@ void PlaylistService::AddMediaFilesFromItems(
   if (items.empty())
     return;
 
-  base::flat_set<GURL> already_added_media;
-  base::ranges::transform(
-      GetAllPlaylistItems(),
-      std::inserter(already_added_media, already_added_media.end()),
-      [](const auto& item) { return item->media_source; });
-
   std::vector<mojom::PlaylistItemPtr> filtered_items;
-  base::ranges::for_each(
-      items, [&already_added_media, &filtered_items](auto& item) {
-        if (already_added_media.count(item->media_source)) {
-          DVLOG(2) << "Skipping creating item: [id] " << item->id
-                   << " [media url]:" << item->media_source
-                   << " - The media source is already added";
-          return;
-        }
-        filtered_items.push_back(std::move(item));
-      });
+  base::ranges::for_each(items, [this, &filtered_items](auto& item) {
+    if (media_sources_.contains(item->media_source.spec())) {
+      DVLOG(2) << "Skipping creating item: [id] " << item->id
+               << " [media url]:" << item->media_source
+               << " - The media source is already added";
+      return;
+    }
+    filtered_items.push_back(std::move(item));
+  });
   if (filtered_items.empty()) {
     return;
   }
@@ -525,15 +525,41 @@ std::string PlaylistService::GetDefaultSaveTargetListID() {
 
 void PlaylistService::UpdatePlaylistItemValue(const std::string& id,
                                               base::Value value) {
+  DCHECK(value.is_dict());
+
   ScopedDictPrefUpdate playlist_items(prefs_, kPlaylistItemsPref);
+  if (const auto* old_value = playlist_items->FindDict(id)) {
+    if (const auto* media_source = FindPlaylistItemMediaSource(*old_value))
+      media_sources_.erase(*media_source);
+  }
+  if (const auto* media_source = FindPlaylistItemMediaSource(value.GetDict()))
+    media_sources_.insert(*media_source);
+
   playlist_items->Set(id, std::move(value));
 }
 
 void PlaylistService::RemovePlaylistItemValue(const std::string& id) {
   ScopedDictPrefUpdate playlist_items(prefs_, kPlaylistItemsPref);
+  if (const auto* value = playlist_items->FindDict(id)) {
+    if (const auto* media_source = FindPlaylistItemMediaSource(*value))
+      media_sources_.erase(*media_source);
+  }
+
   playlist_items->Remove(id);
 }
 
+void PlaylistService::InitMediaSources() {
+  std::vector<std::string> media_sources;
+  for (const auto [id, item_value] : prefs_->GetDict(kPlaylistItemsPref)) {
+    DCHECK(item_value.is_dict());
+    if (const auto* media_source =
+            FindPlaylistItemMediaSource(item_value.GetDict())) {
+      media_sources.push_back(*media_source);
+    }
+  }
+  media_sources_ = base::flat_set<std::string>(std::move(media_sources));
+}
+
 void PlaylistService::CreatePlaylistItem(const mojom::PlaylistItemPtr& item,
                                          bool cache) {
   VLOG(2) << __func__;
@@ -630,10 +656,16 @@ void PlaylistService::RemovePlaylist(const std::string& playlist_id) {
       return;
     }
 
-    auto playlist = ConvertValueToPlaylist(*target_playlist,
-                                           prefs_->GetDict(kPlaylistItemsPref));
-    for (const auto& item : playlist->items) {
-      RemoveItemFromPlaylist(PlaylistId(playlist_id), PlaylistItemId(item->id),
+    // Copy the ids as removing an item updates the playlist's value.
+    const base::Value::List* playlist_item_ids =
+        FindPlaylistItemIds(*target_playlist);
+    DCHECK(playlist_item_ids);
+    std::vector<std::string> item_ids;
+    for (const auto& id_value : *playlist_item_ids)
+      item_ids.push_back(id_value.GetString());
+
+    for (const auto& item_id : item_ids) {
+      RemoveItemFromPlaylist(PlaylistId(playlist_id), PlaylistItemId(item_id),
                              /* delete= */ true);
     }
 
@@ -653,6 +685,7 @@ void PlaylistService::ResetAll() {
   prefs_->ClearPref(kPlaylistDefaultSaveTargetListID);
   prefs_->ClearPref(kPlaylistItemsPref);
   prefs_->ClearPref(kPlaylistsPref);
+  media_sources_.clear();
 
   // Removes data on disk ------------------------------------------------------
   GetTaskRunner()->PostTask(FROM_HERE,
@@ -669,12 +702,9 @@ void PlaylistService::RenamePlaylist(const std::string& playlist_id,
       playlists_update->FindDict(target_playlist_id);
   DCHECK(playlist_value) << " Playlist " << playlist_id << " not found";
 
-  auto target_playlist = ConvertValueToPlaylist(
-      *playlist_value, prefs_->GetDict(kPlaylistItemsPref));
-
-  target_playlist->name = playlist_name;
-  playlists_update->Set(playlist_id, ConvertPlaylistToValue(target_playlist));
-  std::move(callback).Run(target_playlist.Clone());
+  SetPlaylistName(*playlist_value, playlist_name);
+  std::move(callback).Run(ConvertValueToPlaylist(
+      *playlist_value, prefs_->GetDict(kPlaylistItemsPref)));
 }
 
 void PlaylistService::RecoverLocalDataForItem(
@@ -797,6 +827,7 @@ void PlaylistService::DeleteAllPlaylistItems() {
   thumbnail_downloader_->CancelAllDownloadRequests();
 
   prefs_->ClearPref(kPlaylistItemsPref);
+  media_sources_.clear();
   NotifyPlaylistChanged(mojom::PlaylistEvent::kAllDeleted, "");
 
   CleanUpOrphanedPlaylistItemDirs();
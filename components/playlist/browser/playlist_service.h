@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
@@ -185,7 +186,16 @@ class PlaylistService : public KeyedService,
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, CreateAndRemovePlaylist);
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ReorderItemFromPlaylist);
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, RemoveItemFromPlaylist);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           AddItemsAlreadyInPlaylist);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           RemoveAndReorderItemsFromPlaylist);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, RenamePlaylist);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, RejectDuplicatedMedia);
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ResetAll);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ConcurrentMediaDownloads);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           DuplicatedMediaDownloadDoesNotBlockQueue);
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
                            CleanUpOrphanedPlaylistItemDirs);
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceWithFakeUAUnitTest,
@@ -243,8 +253,10 @@ class PlaylistService : public KeyedService,
   void NotifyPlaylistChanged(mojom::PlaylistEvent playlist_event,
                              const std::string& playlist_id);
 
+  // These keep |media_sources_| in sync with the items pref.
   void UpdatePlaylistItemValue(const std::string& id, base::Value value);
   void RemovePlaylistItemValue(const std::string& id);
+  void InitMediaSources();
 
   bool HasPrefStorePlaylistItem(const std::string& id) const;
 
@@ -321,6 +333,10 @@ class PlaylistService : public KeyedService,
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   raw_ptr<PrefService> prefs_ = nullptr;
 
+  // Media sources of all items in the items pref, so that adding media
+  // doesn't go through the whole library to skip duplicates.
+  base::flat_set<std::string> media_sources_;
+
 #if BUILDFLAG(IS_ANDROID)
   mojo::ReceiverSet<mojom::PlaylistService> receivers_;
 #endif  // BUILDFLAG(IS_ANDROID)
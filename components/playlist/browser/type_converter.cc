@@ -146,4 +146,27 @@ base::Value::Dict ConvertPlaylistToValue(const mojom::PlaylistPtr& playlist) {
   return value;
 }
 
+base::Value::List* FindPlaylistItemIds(base::Value::Dict& playlist_dict) {
+  return playlist_dict.FindList(kPlaylistItemsKey);
+}
+
+const base::Value::List* FindPlaylistItemIds(
+    const base::Value::Dict& playlist_dict) {
+  return playlist_dict.FindList(kPlaylistItemsKey);
+}
+
+void SetPlaylistName(base::Value::Dict& playlist_dict,
+                     const std::string& name) {
+  playlist_dict.Set(kPlaylistNameKey, name);
+}
+
+base::Value::List* FindPlaylistItemParents(base::Value::Dict& item_dict) {
+  return item_dict.FindList(kPlaylistItemParentKey);
+}
+
+const std::string* FindPlaylistItemMediaSource(
+    const base::Value::Dict& item_dict) {
+  return item_dict.FindString(kPlaylistItemMediaSrcKey);
+}
+
 }  // namespace playlist
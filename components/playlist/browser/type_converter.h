@@ -6,6 +6,8 @@
 #ifndef BRAVE_COMPONENTS_PLAYLIST_BROWSER_TYPE_CONVERTER_H_
 #define BRAVE_COMPONENTS_PLAYLIST_BROWSER_TYPE_CONVERTER_H_
 
+#include <string>
+
 #include "base/values.h"
 #include "brave/components/playlist/browser/playlist_types.h"
 #include "brave/components/playlist/common/mojom/playlist.mojom.h"
@@ -30,6 +32,18 @@ mojom::PlaylistPtr ConvertValueToPlaylist(
     const base::Value::Dict& items_dict);
 base::Value::Dict ConvertPlaylistToValue(const mojom::PlaylistPtr& playlist);
 
+// Accessors for updating values in place -------------------------------------
+// Converting a playlist converts all of its items, so operations that only
+// touch the membership or the name of a playlist should use these instead.
+base::Value::List* FindPlaylistItemIds(base::Value::Dict& playlist_dict);
+const base::Value::List* FindPlaylistItemIds(
+    const base::Value::Dict& playlist_dict);
+void SetPlaylistName(base::Value::Dict& playlist_dict, const std::string& name);
+
+base::Value::List* FindPlaylistItemParents(base::Value::Dict& item_dict);
+const std::string* FindPlaylistItemMediaSource(
+    const base::Value::Dict& item_dict);
+
 }  // namespace playlist
 
 #endif  // BRAVE_COMPONENTS_PLAYLIST_BROWSER_TYPE_CONVERTER_H_
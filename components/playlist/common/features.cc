@@ -16,4 +16,7 @@ BASE_FEATURE(kPlaylistFakeUA,
              "PlaylistFakeUA",
              base::FEATURE_DISABLED_BY_DEFAULT);
 
+constexpr base::FeatureParam<int> kPlaylistMaxConcurrentMediaDownloads{
+    &kPlaylist, "max_concurrent_media_downloads", 3};
+
 }  // namespace playlist::features
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_PLAYLIST_COMMON_FEATURES_H_
 
 #include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
 
 namespace playlist::features {
 
@@ -14,6 +15,9 @@ BASE_DECLARE_FEATURE(kPlaylist);
 
 BASE_DECLARE_FEATURE(kPlaylistFakeUA);
 
+// The number of media files downloaded at the same time.
+extern const base::FeatureParam<int> kPlaylistMaxConcurrentMediaDownloads;
+
 }  // namespace playlist::features
 
 #endif  // BRAVE_COMPONENTS_PLAYLIST_COMMON_FEATURES_H_
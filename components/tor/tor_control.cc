@@ -127,6 +127,23 @@ void TorControl::Stop() {
                                            weak_ptr_factory_.GetWeakPtr()));
 }
 
+// SetRawTrafficNotificationsEnabled(enabled)
+//
+//      Enable or disable the OnTorRaw* debugging notifications.
+//
+void TorControl::SetRawTrafficNotificationsEnabled(bool enabled) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(owner_sequence_checker_);
+  io_task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(&TorControl::DoSetRawTrafficNotificationsEnabled,
+                     weak_ptr_factory_.GetWeakPtr(), enabled));
+}
+
+void TorControl::DoSetRawTrafficNotificationsEnabled(bool enabled) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
+  notify_raw_traffic_ = enabled;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Opening the connection and authenticating
 
@@ -348,7 +365,8 @@ void TorControl::DoCmd(std::string cmd,
                        PerLineCallback perline,
                        CmdCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
-  NotifyTorRawCmd(cmd);
+  if (notify_raw_traffic_)
+    NotifyTorRawCmd(cmd);
   if (!socket_ || writeq_.size() > 100 || cmdq_.size() > 100) {
     // Socket is closed, or over 100 commands pending or synchronous
     // callbacks queued -- something is probably wrong.
@@ -817,8 +835,10 @@ void TorControl::ReadDone(int rv) {
         // CRLF seen, so we must have i >= 2.  Emit a line and advance
         // to the next one, unless anything went wrong with the line.
         assert(i >= 1);
-        std::string line(readiobuf_->StartOfBuffer() + read_start_,
-                         readiobuf_->offset() + i - 1 - read_start_);
+        // The line is passed as a view into the buffer, it stays
+        // valid until the buffer is compacted below.
+        base::StringPiece line(readiobuf_->StartOfBuffer() + read_start_,
+                               readiobuf_->offset() + i - 1 - read_start_);
         read_start_ = readiobuf_->offset() + i + 1;
         read_cr_ = false;
         if (!ReadLine(line)) {
@@ -872,9 +892,11 @@ void TorControl::ReadDone(int rv) {
 // ReadLine(line)
 //
 //      We have read a line of input; process it.  Return true on
-//      success, false on error.
+//      success, false on error.  The line is a view into readiobuf_
+//      and is only valid for the duration of the call, so anything
+//      that outlives it must be copied.
 //
-bool TorControl::ReadLine(const std::string& line) {
+bool TorControl::ReadLine(base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
 
   if (line.size() < 4) {
@@ -889,21 +911,22 @@ bool TorControl::ReadLine(const std::string& line) {
   // intermediate reply and ` ' for a final reply.
   //
   // TODO(riastradh): parse or check syntax of status
-  std::string status(line, 0, 3);
-  char pos = line[3];
-  std::string reply(line, 4);
+  const base::StringPiece status = line.substr(0, 3);
+  const char pos = line[3];
+  const base::StringPiece reply = line.substr(4);
 
   // Determine whether it is an asynchronous reply, status 6yz.
   if (status[0] == '6') {
     // Notify delegate of the raw reply.
-    NotifyTorRawAsync(status, reply);
+    if (notify_raw_traffic_)
+      NotifyTorRawAsync(std::string(status), std::string(reply));
 
     // Is this a new async reply?
     if (!async_) {
       // Parse the keyword and the initial line.
       const size_t sp = reply.find(' ');
-      std::string event_name, initial;
-      if (sp == std::string::npos) {
+      base::StringPiece event_name, initial;
+      if (sp == base::StringPiece::npos) {
         event_name = reply;
       } else {
         event_name = reply.substr(0, sp);
@@ -931,23 +954,29 @@ bool TorControl::ReadLine(const std::string& line) {
 
           // Notify the delegate of the parsed reply.  No extra
           // because there were no intermediate reply lines.
-          NotifyTorEvent(event, initial, {});
+          NotifyTorEvent(event, std::string(initial), {});
 
           return true;
         }
         case '-': {
           // Start of a multi-line async reply.
 
-          // Start a fresh async reply state.  Parse the rest, but
-          // skip it, if we don't recognize the event.
+          // Start a fresh async reply state.  Skip the rest of the
+          // reply without parsing it if we don't recognize the event
+          // or aren't subscribed to it.
           const auto& found = kTorControlEventByName.find(event_name);
           const TorControlEvent event =
               (found == kTorControlEventByName.end() ? TorControlEvent::INVALID
                                                      : (*found).second);
           async_ = std::make_unique<Async>();
+          async_->skip = (event == TorControlEvent::INVALID ||
+                          !async_events_.count(event));
+          if (async_->skip) {
+            async_->event = TorControlEvent::INVALID;
+            return true;
+          }
           async_->event = event;
-          async_->initial = initial;
-          async_->skip = (event == TorControlEvent::INVALID);
+          async_->initial = std::string(initial);
           return true;
         }
       }
@@ -974,12 +1003,12 @@ bool TorControl::ReadLine(const std::string& line) {
             Error();
             return false;
           }
-          if (async_->extra.count(key)) {
+          if (!async_->extra.emplace(std::move(key), std::move(value))
+                   .second) {
             VLOG(1) << "tor: duplicate key in async continuation line";
             Error();
             return false;
           }
-          async_->extra[key] = value;
           return true;
         }
         case ' ': {
@@ -992,12 +1021,12 @@ bool TorControl::ReadLine(const std::string& line) {
               Error();
               return false;
             }
-            if (async_->extra.count(key)) {
+            if (!async_->extra.emplace(std::move(key), std::move(value))
+                     .second) {
               VLOG(1) << "tor: duplicate key in async event";
               Error();
               return false;
             }
-            async_->extra[key] = value;
 
             // If we're still subscribed, notify the delegate of the
             // parsed reply.
@@ -1014,26 +1043,34 @@ bool TorControl::ReadLine(const std::string& line) {
     // Synchronous reply.  Return it to the next command callback in
     // the queue.
     switch (pos) {
-      case '-':
-        NotifyTorRawMid(status, reply);
+      case '-': {
+        const std::string status_string(status);
+        const std::string reply_string(reply);
+        if (notify_raw_traffic_)
+          NotifyTorRawMid(status_string, reply_string);
         if (!cmdq_.empty()) {
           PerLineCallback& perline = cmdq_.front().first;
-          perline.Run(status, reply);
+          perline.Run(status_string, reply_string);
         }
         return true;
+      }
       case '+':
         VLOG(2) << "tor: NYI: control data reply";
         // XXX Just ignore it for now.
         return true;
-      case ' ':
-        NotifyTorRawEnd(status, reply);
+      case ' ': {
+        const std::string status_string(status);
+        const std::string reply_string(reply);
+        if (notify_raw_traffic_)
+          NotifyTorRawEnd(status_string, reply_string);
         if (!cmdq_.empty()) {
           CmdCallback& callback = cmdq_.front().second;
           bool error = false;
-          std::move(callback).Run(error, status, reply);
+          std::move(callback).Run(error, status_string, reply_string);
           cmdq_.pop();
         }
         return true;
+      }
     }
   }
 
@@ -1139,7 +1176,7 @@ void TorControl::NotifyTorRawEnd(const std::string& status,
 //      success, false on failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value) {
   size_t end;
@@ -1154,21 +1191,21 @@ bool TorControl::ParseKV(const std::string& string,
 //      failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value,
                          size_t* end) {
   DCHECK(key && value && end);
   // Search for `=' -- it had better be there.
-  size_t eq = string.find("=");
-  if (eq == std::string::npos)
+  size_t eq = string.find('=');
+  if (eq == base::StringPiece::npos)
     return false;
   size_t vstart = eq + 1;
 
   // If we're at the end of the string, value is empt.
   if (vstart == string.size()) {
-    *key = string.substr(0, eq);
-    *value = "";
+    *key = std::string(string.substr(0, eq));
+    value->clear();
     *end = string.size();
     return true;
   }
@@ -1177,7 +1214,7 @@ bool TorControl::ParseKV(const std::string& string,
   if (string[vstart] != '"') {
     // Not quoted.  Check for a delimiter.
     size_t i, vend = string.size();
-    if ((i = string.find(" ", vstart)) != std::string::npos) {
+    if ((i = string.find(' ', vstart)) != base::StringPiece::npos) {
       // Delimited.  Stop at the delimiter, and consume it.
       vend = i;
       *end = vend + 1;
@@ -1187,19 +1224,19 @@ bool TorControl::ParseKV(const std::string& string,
     }
 
     // Check for internal quotes; they are forbidden.
-    if (string.find("\"", vstart) != std::string::npos)
+    if (string.find('"', vstart) != base::StringPiece::npos)
       return false;
 
     // Extract the key and value and we're done.
-    *key = string.substr(0, eq);
-    *value = string.substr(vstart, vend - vstart);
+    *key = std::string(string.substr(0, eq));
+    *value = std::string(string.substr(vstart, vend - vstart));
     return true;
   }
 
   // Quoted string.  Parse it, and consume trailing spaces.
   if (!ParseQuoted(string.substr(eq + 1), value, end))
     return false;
-  *key = string.substr(0, eq);
+  *key = std::string(string.substr(0, eq));
   *end += eq + 1;
   while (*end < string.size() && string[*end] == ' ')
     (*end)++;
@@ -1214,7 +1251,7 @@ bool TorControl::ParseKV(const std::string& string,
 //      return false on failure.
 //
 // static
-bool TorControl::ParseQuoted(const std::string& string,
+bool TorControl::ParseQuoted(base::StringPiece string,
                              std::string* value,
                              size_t* end) {
   enum {
@@ -1339,7 +1376,8 @@ bool TorControl::ParseQuoted(const std::string& string,
       case REJECT:
         return false;
       case ACCEPT:
-        *value = buf.substr(0, pos);
+        buf.resize(pos);
+        *value = std::move(buf);
         *end = i + 1;
         return true;
       default:
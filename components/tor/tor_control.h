@@ -17,6 +17,7 @@
 #include "base/functional/callback_forward.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/tor/tor_control_event.h"
 
 namespace base {
@@ -61,7 +62,8 @@ class TorControl {
         const std::string& initial,
         const std::map<std::string, std::string>& extra) = 0;
 
-    // Debugging options.
+    // Debugging options, only issued after
+    // SetRawTrafficNotificationsEnabled(true).
     virtual void OnTorRawCmd(const std::string& cmd) {}
     virtual void OnTorRawAsync(const std::string& status,
                                const std::string& line) {}
@@ -78,6 +80,11 @@ class TorControl {
   void Start(std::vector<uint8_t> cookie, int port);
   void Stop();
 
+  // Forwarding every raw command and reply line to the delegate costs a
+  // copy and a task per line, so it is off unless the delegate wants to
+  // log the traffic.
+  void SetRawTrafficNotificationsEnabled(bool enabled);
+
   void Subscribe(TorControlEvent event,
                  base::OnceCallback<void(bool error)> callback);
   void Unsubscribe(TorControlEvent event,
@@ -104,22 +111,24 @@ class TorControl {
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseQuoted);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseKV);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadLine);
+  FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadLineUnsubscribedEvents);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, GetCircuitEstablishedDone);
 
-  static bool ParseKV(const std::string& string,
+  static bool ParseKV(base::StringPiece string,
                       std::string* key,
                       std::string* value);
-  static bool ParseKV(const std::string& string,
+  static bool ParseKV(base::StringPiece string,
                       std::string* key,
                       std::string* value,
                       size_t* end);
-  static bool ParseQuoted(const std::string& string,
+  static bool ParseQuoted(base::StringPiece string,
                           std::string* value,
                           size_t* end);
 
  private:
   void OpenControl(int port, std::vector<uint8_t> cookie);
   void StopOnTaskRunner();
+  void DoSetRawTrafficNotificationsEnabled(bool enabled);
   void Connected(std::vector<uint8_t> cookie, int rv);
   void Authenticated(bool error,
                      const std::string& status,
@@ -203,7 +212,7 @@ class TorControl {
   void DoReads();
   void ReadDoneAsync(int rv);
   void ReadDone(int rv);
-  bool ReadLine(const std::string& line);
+  bool ReadLine(base::StringPiece line);
 
   void Error();
 
@@ -211,6 +220,7 @@ class TorControl {
   TorControl& operator=(const TorControl&) = delete;
 
   bool running_;
+  bool notify_raw_traffic_ = false;
   scoped_refptr<base::SequencedTaskRunner> owner_task_runner_;
   SEQUENCE_CHECKER(owner_sequence_checker_);
 
@@ -131,6 +131,7 @@ TEST(TorControlTest, ReadLine) {
   io_task_runner->PostTask(
       FROM_HERE, base::BindOnce(
                      [](std::unique_ptr<TorControl> control) {
+                       control->notify_raw_traffic_ = true;
                        EXPECT_TRUE(control->ReadLine("250-SOCKSPORT=9050"));
                        EXPECT_TRUE(control->ReadLine("250 OK"));
                      },
@@ -160,6 +161,7 @@ TEST(TorControlTest, ReadLine) {
       FROM_HERE,
       base::BindOnce(
           [](std::unique_ptr<TorControl> control) {
+            control->notify_raw_traffic_ = true;
             EXPECT_FALSE(control->ReadLine("650 FAKEVENT WHAT"));
             EXPECT_TRUE(control->ReadLine("650 NETWORK_LIVENESS UP"));
             // Emulate subscribe
@@ -186,6 +188,54 @@ TEST(TorControlTest, ReadLine) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST(TorControlTest, ReadLineUnsubscribedEvents) {
+  content::BrowserTaskEnvironment task_environment;
+  scoped_refptr<base::SequencedTaskRunner> io_task_runner =
+      content::GetIOThreadTaskRunner({});
+
+  MockTorControlDelegate delegate;
+  std::unique_ptr<TorControl> control =
+      std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
+
+  // Raw traffic isn't forwarded unless it was asked for.
+  EXPECT_CALL(delegate, OnTorRawAsync(testing::_, testing::_)).Times(0);
+  EXPECT_CALL(delegate, OnTorRawMid(testing::_, testing::_)).Times(0);
+  EXPECT_CALL(delegate, OnTorRawEnd(testing::_, testing::_)).Times(0);
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::CIRC, testing::_,
+                                   testing::_))
+      .Times(0);
+  std::map<std::string, std::string> stream_extra = {{"PURPOSE", "USER"}};
+  EXPECT_CALL(delegate,
+              OnTorEvent(TorControlEvent::STREAM,
+                         "12 SUCCEEDED 5 brave.com:443", stream_extra))
+      .Times(1);
+  io_task_runner->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](std::unique_ptr<TorControl> control) {
+            control->async_events_[TorControlEvent::STREAM] = 1;
+            // Events we aren't subscribed to are skipped without being
+            // parsed, even if their continuation lines are malformed.
+            EXPECT_TRUE(control->ReadLine("650-CIRC 5 BUILT"));
+            ASSERT_TRUE(control->async_);
+            EXPECT_TRUE(control->async_->skip);
+            EXPECT_TRUE(control->async_->initial.empty());
+            EXPECT_TRUE(control->ReadLine("650-NOT A KEY VALUE"));
+            EXPECT_TRUE(control->ReadLine("650 PURPOSE=GENERAL"));
+            EXPECT_FALSE(control->async_);
+            EXPECT_TRUE(control->ReadLine("650 CIRC 6 EXTENDED"));
+            // Subscribed events are still delivered.
+            EXPECT_TRUE(control->ReadLine("650-STREAM 12 SUCCEEDED 5 "
+                                          "brave.com:443"));
+            EXPECT_TRUE(control->ReadLine("650 PURPOSE=USER"));
+            EXPECT_FALSE(control->async_);
+            EXPECT_TRUE(control->ReadLine("250 OK"));
+          },
+          std::move(control)));
+
+  base::RunLoop().RunUntilIdle();
+}
+
 TEST(TorControlTest, GetCircuitEstablishedDone) {
   content::BrowserTaskEnvironment task_environment;
   scoped_refptr<base::SequencedTaskRunner> io_task_runner =
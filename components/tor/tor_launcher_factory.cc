@@ -10,6 +10,7 @@
 
 #include "base/functional/bind.h"
 #include "base/functional/callback_helpers.h"
+#include "base/logging.h"
 #include "base/task/bind_post_task.h"
 #include "base/task/sequenced_task_runner.h"
 #include "brave/components/tor/tor_file_watcher.h"
@@ -57,6 +58,8 @@ TorLauncherFactory::TorLauncherFactory()
                base::OnTaskRunnerDeleter(content::GetIOThreadTaskRunner({}))),
       weak_ptr_factory_(this) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // The raw control traffic is only logged.
+  control_->SetRawTrafficNotificationsEnabled(VLOG_IS_ON(3));
 }
 
 void TorLauncherFactory::Init() {
@@ -0,0 +1,22 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/url_sanitizer/browser/query_string_utils.h"
+
+namespace brave {
+
+absl::optional<base::StringPiece> GetQueryParameterKey(base::StringPiece kv) {
+  const size_t key_start = kv.find_first_not_of('=');
+  if (key_start == base::StringPiece::npos)
+    return absl::nullopt;
+  const size_t key_end = kv.find('=', key_start);
+  if (key_end == base::StringPiece::npos ||
+      kv.find_first_not_of('=', key_end) == base::StringPiece::npos) {
+    return absl::nullopt;
+  }
+  return kv.substr(key_start, key_end - key_start);
+}
+
+}  // namespace brave
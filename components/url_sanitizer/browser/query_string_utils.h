@@ -0,0 +1,62 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_URL_SANITIZER_BROWSER_QUERY_STRING_UTILS_H_
+#define BRAVE_COMPONENTS_URL_SANITIZER_BROWSER_QUERY_STRING_UTILS_H_
+
+#include <string>
+
+#include "base/strings/string_piece.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave {
+
+// Returns the key of a KEY=VALUE query parameter if both the key and the
+// value are non empty. Leading and repeated `=' are ignored, the same as
+// splitting on `=' and dropping the empty pieces.
+absl::optional<base::StringPiece> GetQueryParameterKey(base::StringPiece kv);
+
+// Removes the parameters whose key satisfies |is_tracker| from |query| in a
+// single pass, all other parameters are kept untouched. Nothing is copied
+// until the first tracking parameter is found, and absl::nullopt is returned
+// if there was none.
+//
+// We are using custom query string parsing code here. See
+// https://github.com/brave/brave-core/pull/13726#discussion_r897712350
+// for more information on why this approach was selected.
+template <typename IsTracker>
+absl::optional<std::string> StripQueryTrackers(base::StringPiece query,
+                                               const IsTracker& is_tracker) {
+  absl::optional<std::string> result;
+  bool first = true;
+  size_t start = 0;
+  while (start <= query.size()) {
+    size_t end = query.find('&', start);
+    if (end == base::StringPiece::npos)
+      end = query.size();
+    const base::StringPiece kv = query.substr(start, end - start);
+    const auto key = GetQueryParameterKey(kv);
+    if (key && is_tracker(*key)) {
+      if (!result) {
+        // Everything before the first tracker is kept as is.
+        result.emplace();
+        result->reserve(query.size());
+        result->append(query.data(), start > 0 ? start - 1 : 0);
+        first = start == 0;
+      }
+    } else if (result) {
+      if (!first)
+        result->push_back('&');
+      result->append(kv.data(), kv.size());
+      first = false;
+    }
+    start = end + 1;
+  }
+  return result;
+}
+
+}  // namespace brave
+
+#endif  // BRAVE_COMPONENTS_URL_SANITIZER_BROWSER_QUERY_STRING_UTILS_H_
@@ -5,15 +5,19 @@
 
 #include "brave/components/url_sanitizer/browser/url_sanitizer_service.h"
 
+#include <iterator>
+#include <map>
 #include <memory>
 #include <vector>
 
+#include "base/containers/contains.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
-#include "base/strings/string_split.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_util.h"
 #include "base/task/thread_pool.h"
 #include "base/values.h"
+#include "brave/components/url_sanitizer/browser/query_string_utils.h"
 #include "extensions/common/url_pattern.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
@@ -112,66 +116,103 @@ void URLSanitizerService::Initialize(const std::string& json) {
 void URLSanitizerService::UpdateMatchers(
     base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> mappings) {
   matchers_ = std::move(mappings);
+
+  std::map<std::string, std::vector<const MatchItem*>> host_matchers;
+  wildcard_matchers_.clear();
+  for (const auto& item : matchers_) {
+    const bool wildcard =
+        base::ranges::any_of(item->include, [](const URLPattern& pattern) {
+          return pattern.match_all_urls() || pattern.host().empty();
+        });
+    if (wildcard) {
+      wildcard_matchers_.push_back(item.get());
+      continue;
+    }
+    for (const auto& pattern : item->include) {
+      auto& bucket = host_matchers[pattern.host()];
+      if (!base::Contains(bucket, item.get()))
+        bucket.push_back(item.get());
+    }
+  }
+  host_matchers_ = base::flat_map<std::string, std::vector<const MatchItem*>>(
+      std::make_move_iterator(host_matchers.begin()),
+      std::make_move_iterator(host_matchers.end()));
+
   if (initialization_callback_for_testing_)
     std::move(initialization_callback_for_testing_).Run();
 }
 
+std::vector<const URLSanitizerService::MatchItem*>
+URLSanitizerService::GetCandidateMatchers(const GURL& url) const {
+  std::vector<const MatchItem*> candidates = wildcard_matchers_;
+  // Look up the host and all of its parent domains, e.g. a.b.com, b.com
+  // and com. A fully qualified host such as "b.com." is looked up without
+  // its trailing dot, the same way the URL patterns match it.
+  base::StringPiece host = url.host_piece();
+  if (base::EndsWith(host, "."))
+    host.remove_suffix(1);
+  while (!host.empty()) {
+    auto it = host_matchers_.find(host);
+    if (it != host_matchers_.end()) {
+      for (const auto* item : it->second) {
+        if (!base::Contains(candidates, item))
+          candidates.push_back(item);
+      }
+    }
+    const size_t dot = host.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    host.remove_prefix(dot + 1);
+  }
+  return candidates;
+}
+
 GURL URLSanitizerService::SanitizeURL(const GURL& initial_url) {
   if (matchers_.empty() || !initial_url.SchemeIsHTTPOrHTTPS())
     return initial_url;
-  GURL url = initial_url;
-  for (const auto& it : matchers_) {
-    if (!it->include.MatchesURL(url) || it->exclude.MatchesURL(url))
-      continue;
-    auto sanitized_query = StripQueryParameter(url.query(), it->params);
-    GURL::Replacements replacements;
-    if (!sanitized_query.empty()) {
-      replacements.SetQueryStr(sanitized_query);
-    } else {
-      replacements.ClearQuery();
+  std::vector<const MatchItem*> matched;
+  for (const auto* item : GetCandidateMatchers(initial_url)) {
+    if (item->include.MatchesURL(initial_url) &&
+        !item->exclude.MatchesURL(initial_url)) {
+      matched.push_back(item);
     }
-    url = url.ReplaceComponents(replacements);
   }
-  return url;
+  if (matched.empty() || !initial_url.has_query())
+    return initial_url;
+
+  // Strip the parameters of all matched rules in a single pass.
+  const auto sanitized_query = StripQueryTrackers(
+      initial_url.query_piece(), [&matched](base::StringPiece key) {
+        return base::ranges::any_of(matched, [key](const MatchItem* item) {
+          return item->params.contains(key);
+        });
+      });
+  // Nothing was stripped, an empty query is still cleared below.
+  if (!sanitized_query && !initial_url.query_piece().empty())
+    return initial_url;
+  GURL::Replacements replacements;
+  if (sanitized_query && !sanitized_query->empty()) {
+    replacements.SetQueryStr(*sanitized_query);
+  } else {
+    replacements.ClearQuery();
+  }
+  return initial_url.ReplaceComponents(replacements);
 }
 
 void URLSanitizerService::OnRulesReady(const std::string& json_content) {
   Initialize(json_content);
 }
 
-// FIXME: merge with
-// browser/net/brave_site_hacks_network_delegate_helper.cc::StripQueryParameter()
 // Remove tracking query parameters from a GURL, leaving all
 // other parts untouched.
 std::string URLSanitizerService::StripQueryParameter(
-    const std::string& query,
+    base::StringPiece query,
     const base::flat_set<std::string>& trackers) {
-  // We are using custom query string parsing code here. See
-  // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
-  // for more information on why this approach was selected.
-  //
-  // Split query string by ampersands, remove tracking parameters,
-  // then join the remaining query parameters, untouched, back into
-  // a single query string.
-  const std::vector<std::string> input_kv_strings =
-      SplitString(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
-  std::vector<std::string> output_kv_strings;
-  int disallowed_count = 0;
-  for (const std::string& kv_string : input_kv_strings) {
-    const std::vector<std::string> pieces = SplitString(
-        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-    const std::string& key = pieces.empty() ? std::string() : pieces[0];
-    if (pieces.size() >= 2 && trackers.count(key) == 1) {
-      ++disallowed_count;
-    } else {
-      output_kv_strings.push_back(kv_string);
-    }
-  }
-  if (disallowed_count > 0) {
-    return base::JoinString(output_kv_strings, "&");
-  } else {
-    return query;
-  }
+  return StripQueryTrackers(query,
+                            [&trackers](base::StringPiece key) {
+                              return trackers.contains(key);
+                            })
+      .value_or(std::string(query));
 }
 
 }  // namespace brave
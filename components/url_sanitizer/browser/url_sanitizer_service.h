@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
@@ -55,11 +56,21 @@ class URLSanitizerService : public KeyedService,
   void UpdateMatchers(
       base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>>);
 
-  std::string StripQueryParameter(const std::string& query,
+  std::string StripQueryParameter(base::StringPiece query,
                                   const base::flat_set<std::string>& trackers);
 
  private:
+  // Returns the rules whose include patterns may match |url|, the caller
+  // still has to check the patterns.
+  std::vector<const MatchItem*> GetCandidateMatchers(const GURL& url) const;
+
   base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> matchers_;
+  // Index of |matchers_| by the host of their include patterns, built when
+  // the rules are loaded. Patterns matching subdomains are keyed by their
+  // base host and found by walking up the labels of the url's host.
+  base::flat_map<std::string, std::vector<const MatchItem*>> host_matchers_;
+  // Rules with an include pattern that matches any host.
+  std::vector<const MatchItem*> wildcard_matchers_;
   base::OnceClosure initialization_callback_for_testing_;
   base::WeakPtrFactory<URLSanitizerService> weak_factory_{this};
 };
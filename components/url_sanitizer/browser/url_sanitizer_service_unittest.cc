@@ -86,6 +86,11 @@ TEST_F(URLSanitizerServiceUnitTest, StripQueryParameter) {
       "param1=1");
   EXPECT_EQ(StripQueryParameter("param1=1", list), "param1=1");
   EXPECT_EQ(StripQueryParameter("", list), "");
+  EXPECT_EQ(StripQueryParameter("&fbclid=1&param1=1&", list), "&param1=1&");
+  EXPECT_EQ(StripQueryParameter("param1=1&=fbclid=1&fbclid==1", list),
+            "param1=1");
+  EXPECT_EQ(StripQueryParameter("fbclid=&fbclid==&fbclid", list),
+            "fbclid=&fbclid==&fbclid");
 }
 
 TEST_F(URLSanitizerServiceUnitTest, ClearURLS) {
@@ -154,4 +159,51 @@ TEST_F(URLSanitizerServiceUnitTest, ClearURLS) {
             GURL("ws://localhost:8080/?utm_source=web"));
 }
 
+TEST_F(URLSanitizerServiceUnitTest, HostIndex) {
+  WaitInitialization(R"([
+    { "include": [ "*://*.twitter.com/*", "https://x.com/*" ],
+      "params": ["t"] },
+    { "include": [ "https://brave.com/*" ],
+      "exclude": [ "https://brave.com/keep/*" ],
+      "params": ["b"] },
+    { "include": [ "*://*/*" ], "params": ["all"] }
+  ])");
+
+  // Subdomains are matched through the parent domain bucket.
+  EXPECT_EQ(SanitizeURL(GURL("https://a.b.twitter.com/?t=1&b=1&all=1&k=v")),
+            GURL("https://a.b.twitter.com/?b=1&k=v"));
+  EXPECT_EQ(SanitizeURL(GURL("https://x.com/?t=1&k=v")),
+            GURL("https://x.com/?k=v"));
+  // Patterns without a subdomain wildcard match only their exact host.
+  EXPECT_EQ(SanitizeURL(GURL("https://sub.x.com/?t=1&all=1")),
+            GURL("https://sub.x.com/?t=1"));
+  EXPECT_EQ(SanitizeURL(GURL("https://sub.brave.com/?b=1&all=1")),
+            GURL("https://sub.brave.com/?b=1"));
+  // Parameters of all matching rules are stripped in one go.
+  EXPECT_EQ(SanitizeURL(GURL("https://brave.com/?b=1&all=1")),
+            GURL("https://brave.com/"));
+  EXPECT_EQ(SanitizeURL(GURL("https://brave.com/keep/?b=1&all=1")),
+            GURL("https://brave.com/keep/?b=1"));
+  EXPECT_EQ(SanitizeURL(GURL("https://brave.com/?")),
+            GURL("https://brave.com/"));
+  EXPECT_EQ(SanitizeURL(GURL("https://brave.com/?k=v#all=1")),
+            GURL("https://brave.com/?k=v#all=1"));
+}
+
+TEST_F(URLSanitizerServiceUnitTest, HostIndexTrailingDot) {
+  WaitInitialization(R"([
+    { "include": [ "*://*.twitter.com/*" ], "params": ["t"] },
+    { "include": [ "https://brave.com/*" ], "params": ["b"] }
+  ])");
+
+  EXPECT_EQ(SanitizeURL(GURL("https://twitter.com./?t=1&k=v")),
+            GURL("https://twitter.com./?k=v"));
+  EXPECT_EQ(SanitizeURL(GURL("https://a.twitter.com./?t=1&k=v")),
+            GURL("https://a.twitter.com./?k=v"));
+  EXPECT_EQ(SanitizeURL(GURL("https://brave.com./?b=1&k=v")),
+            GURL("https://brave.com./?k=v"));
+  EXPECT_EQ(SanitizeURL(GURL("https://notbrave.com./?b=1&k=v")),
+            GURL("https://notbrave.com./?b=1&k=v"));
+}
+
 }  // namespace brave
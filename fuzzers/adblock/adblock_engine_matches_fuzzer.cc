@@ -65,12 +65,13 @@ std::string ResourceTypeToString(adblock_fuzzer::ResourceType resource_type) {
 
 struct Environment {
   Environment()
-      : engine(brave_component_updater::LoadDATFileData<adblock::Engine>(
+      : engine(brave_component_updater::LoadMappedDATFileData<adblock::Engine>(
             base::FilePath::FromASCII("rs-ABPFilterParserData.dat"))) {
     CHECK(base::i18n::InitializeICU());
   }
 
-  brave_component_updater::LoadDATFileDataResult<adblock::Engine> engine;
+  brave_component_updater::LoadMappedDATFileDataResult<adblock::Engine>
+      engine;
 };
 
 // Make sure 'rs-ABPFilterParserData.dat' file exists in the working directory
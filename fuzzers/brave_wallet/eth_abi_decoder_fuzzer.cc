@@ -0,0 +1,44 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <fuzzer/FuzzedDataProvider.h>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "base/logging.h"
+#include "brave/components/brave_wallet/browser/eth_abi_decoder.h"
+#include "brave/components/brave_wallet/common/eth_abi_utils.h"
+
+struct Environment {
+  Environment() { logging::SetMinLogLevel(logging::LOG_FATAL); }
+};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  static Environment env;
+
+  static const char* const kTypes[] = {
+      "address", "uint8", "uint16",    "uint32", "uint64", "uint128",
+      "uint256", "bool",  "address[]", "bytes",  "string", "bytes32"};
+
+  FuzzedDataProvider data_provider(data, size);
+
+  std::vector<std::string> types;
+  const size_t types_count = data_provider.ConsumeIntegralInRange<size_t>(0, 8);
+  for (size_t i = 0; i < types_count; ++i) {
+    types.push_back(kTypes[data_provider.ConsumeIntegralInRange<size_t>(
+        0, std::size(kTypes) - 1)]);
+  }
+  const size_t tuple_pos = data_provider.ConsumeIntegralInRange<size_t>(0, 4);
+  const std::vector<uint8_t> input =
+      data_provider.ConsumeRemainingBytes<uint8_t>();
+
+  brave_wallet::ABIDecode(types, input);
+  brave_wallet::eth_abi::ExtractBoolBytesArrayFromTupleAsSpans(input,
+                                                               tuple_pos);
+  brave_wallet::eth_abi::ExtractBytesAsSpan(input);
+  return 0;
+}
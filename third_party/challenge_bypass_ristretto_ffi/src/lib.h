@@ -316,6 +316,16 @@ C_SignedToken* signing_key_sign(const C_SigningKey* key,
  */
 C_BlindedToken* token_blind(const C_Token* token);
 
+/**
+ * Take references to `tokens_length` `Token`s and blind them, writing the
+ * resulting `BlindedToken`s to `blinded_tokens` in the same order
+ * Returns -1 if an error was encountered and 0 on success. Don't forget to
+ * destroy each `BlindedToken` once you are done with it!
+ */
+int token_blind_batch(const C_Token* const* tokens,
+                      C_BlindedToken** blinded_tokens,
+                      int tokens_length);
+
 /**
  * Decode from base64 C string.
  * If something goes wrong, this will return a null pointer. Don't forget to
@@ -359,6 +369,15 @@ char* token_preimage_encode_base64(const C_TokenPreimage* t);
  */
 C_Token* token_random(void);
 
+/**
+ * Generate `tokens_length` new `Token`s, writing them to `tokens`
+ * Returns -1 if an error was encountered and 0 on success
+ * # Safety
+ * `tokens` must have room for `tokens_length` pointers. Make sure you
+ * destroy each token with [`token_destroy()`] once you are done with it.
+ */
+int token_random_batch(C_Token** tokens, int tokens_length);
+
 /**
  * Decode from base64 C string.
  * If something goes wrong, this will return a null pointer. Don't forget to
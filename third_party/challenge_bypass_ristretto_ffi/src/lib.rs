@@ -126,6 +126,32 @@ pub unsafe extern "C" fn token_random() -> *mut Token {
     Box::into_raw(Box::new(token))
 }
 
+/// Generate `tokens_length` new `Token`s, writing them to `tokens`
+///
+/// Returns -1 if an error was encountered and 0 on success
+///
+/// # Safety
+///
+/// `tokens` must have room for `tokens_length` pointers. Make sure you
+/// destroy each token with [`token_destroy()`] once you are done with it.
+#[no_mangle]
+pub unsafe extern "C" fn token_random_batch(tokens: *mut *mut Token, tokens_length: c_int) -> c_int {
+    if tokens_length == 0 {
+        return 0;
+    }
+    if tokens.is_null() || tokens_length < 0 {
+        update_last_error("Pointer to tokens was null or length was negative");
+        return -1;
+    }
+
+    let tokens: &mut [*mut Token] = slice::from_raw_parts_mut(tokens, tokens_length as usize);
+    let mut rng = OsRng;
+    for token in tokens.iter_mut() {
+        *token = Box::into_raw(Box::new(Token::random::<Sha512, OsRng>(&mut rng)));
+    }
+    0
+}
+
 /// Destroy a `Token` once you are done with it.
 #[no_mangle]
 pub unsafe extern "C" fn token_destroy(token: *mut Token) {
@@ -148,6 +174,39 @@ pub unsafe extern "C" fn token_blind(token: *const Token) -> *mut BlindedToken {
     Box::into_raw(Box::new((*token).blind()))
 }
 
+/// Take references to `tokens_length` `Token`s and blind them, writing the
+/// resulting `BlindedToken`s to `blinded_tokens` in the same order
+///
+/// Returns -1 if an error was encountered and 0 on success. Don't forget to
+/// destroy each `BlindedToken` once you are done with it!
+#[no_mangle]
+pub unsafe extern "C" fn token_blind_batch(
+    tokens: *const *const Token,
+    blinded_tokens: *mut *mut BlindedToken,
+    tokens_length: c_int,
+) -> c_int {
+    if tokens_length == 0 {
+        return 0;
+    }
+    if tokens.is_null() || blinded_tokens.is_null() || tokens_length < 0 {
+        update_last_error("Pointer to tokens or blinded tokens was null or length was negative");
+        return -1;
+    }
+
+    let tokens: &[*const Token] = slice::from_raw_parts(tokens, tokens_length as usize);
+    if tokens.iter().any(|token| token.is_null()) {
+        update_last_error("Pointer to token was null");
+        return -1;
+    }
+
+    let blinded_tokens: &mut [*mut BlindedToken] =
+        slice::from_raw_parts_mut(blinded_tokens, tokens_length as usize);
+    for (token, blinded_token) in tokens.iter().zip(blinded_tokens.iter_mut()) {
+        *blinded_token = Box::into_raw(Box::new((**token).blind()));
+    }
+    0
+}
+
 impl_base64!(Token, token_encode_base64, token_decode_base64);
 
 /// Destroy a `BlindedToken` once you are done with it.
@@ -674,4 +733,65 @@ mod tests {
             );
         }
     }
+
+    #[test]
+    fn test_batch_random_blind_sign_unblind() {
+        unsafe {
+            for tokens_length in [50, 500] {
+                let key = signing_key_random();
+
+                let mut tokens: Vec<*mut Token> = vec![ptr::null_mut(); tokens_length];
+                assert_eq!(token_random_batch(tokens.as_mut_ptr(), tokens_length as c_int), 0);
+
+                let mut blinded_tokens: Vec<*mut BlindedToken> =
+                    vec![ptr::null_mut(); tokens_length];
+                assert_eq!(
+                    token_blind_batch(
+                        tokens.as_ptr() as *const *const Token,
+                        blinded_tokens.as_mut_ptr(),
+                        tokens_length as c_int,
+                    ),
+                    0
+                );
+
+                let signed_tokens: Vec<*mut SignedToken> =
+                    blinded_tokens.iter().map(|t| signing_key_sign(key, *t)).collect();
+
+                let proof = batch_dleq_proof_new(
+                    blinded_tokens.as_ptr() as *const *const BlindedToken,
+                    signed_tokens.as_ptr() as *const *const SignedToken,
+                    tokens_length as c_int,
+                    key,
+                );
+
+                let mut unblinded_tokens: Vec<*mut UnblindedToken> =
+                    vec![ptr::null_mut(); tokens_length];
+                assert_eq!(
+                    batch_dleq_proof_invalid_or_unblind(
+                        proof,
+                        tokens.as_ptr() as *const *const Token,
+                        blinded_tokens.as_ptr() as *const *const BlindedToken,
+                        signed_tokens.as_ptr() as *const *const SignedToken,
+                        unblinded_tokens.as_mut_ptr(),
+                        tokens_length as c_int,
+                        signing_key_get_public_key(key),
+                    ),
+                    0
+                );
+                assert!(unblinded_tokens.iter().all(|t| !t.is_null()));
+            }
+        }
+    }
+
+    #[test]
+    fn test_batch_empty_and_null() {
+        unsafe {
+            assert_eq!(token_random_batch(ptr::null_mut(), 0), 0);
+            assert_eq!(token_random_batch(ptr::null_mut(), 1), -1);
+
+            let tokens: Vec<*const Token> = vec![ptr::null()];
+            let mut blinded_tokens: Vec<*mut BlindedToken> = vec![ptr::null_mut()];
+            assert_eq!(token_blind_batch(tokens.as_ptr(), blinded_tokens.as_mut_ptr(), 1), -1);
+        }
+    }
 }
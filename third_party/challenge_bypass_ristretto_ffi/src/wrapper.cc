@@ -57,6 +57,21 @@ base::expected<Token, std::string> Token::random() {
   return Token(raw_token);
 }
 
+base::expected<std::vector<Token>, std::string> Token::random_batch(
+    size_t count) {
+  std::vector<C_Token*> raw_tokens(count);
+  if (token_random_batch(raw_tokens.data(), raw_tokens.size()) != 0) {
+    return base::unexpected("Failed to generate random tokens");
+  }
+
+  std::vector<Token> tokens;
+  tokens.reserve(raw_tokens.size());
+  for (C_Token* raw_token : raw_tokens) {
+    tokens.emplace_back(std::shared_ptr<C_Token>(raw_token, token_destroy));
+  }
+  return tokens;
+}
+
 base::expected<BlindedToken, std::string> Token::blind() {
   std::shared_ptr<C_BlindedToken> raw_blinded(token_blind(raw.get()),
                                               blinded_token_destroy);
@@ -67,6 +82,32 @@ base::expected<BlindedToken, std::string> Token::blind() {
   return BlindedToken(raw_blinded);
 }
 
+base::expected<std::vector<BlindedToken>, std::string> Token::blind_batch(
+    const std::vector<Token>& tokens) {
+  std::vector<const C_Token*> raw_tokens;
+  raw_tokens.reserve(tokens.size());
+  for (const Token& token : tokens) {
+    if (!token.raw.get()) {
+      return base::unexpected("Failed to blind");
+    }
+    raw_tokens.push_back(token.raw.get());
+  }
+
+  std::vector<C_BlindedToken*> raw_blinded_tokens(raw_tokens.size());
+  if (token_blind_batch(raw_tokens.data(), raw_blinded_tokens.data(),
+                        raw_tokens.size()) != 0) {
+    return base::unexpected("Failed to blind");
+  }
+
+  std::vector<BlindedToken> blinded_tokens;
+  blinded_tokens.reserve(raw_blinded_tokens.size());
+  for (C_BlindedToken* raw_blinded : raw_blinded_tokens) {
+    blinded_tokens.emplace_back(
+        std::shared_ptr<C_BlindedToken>(raw_blinded, blinded_token_destroy));
+  }
+  return blinded_tokens;
+}
+
 base::expected<Token, std::string> Token::decode_base64(
     const std::string encoded) {
   std::shared_ptr<C_Token> raw_tok(
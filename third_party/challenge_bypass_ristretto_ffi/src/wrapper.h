@@ -152,7 +152,14 @@ class CHALLENGE_BYPASS_RISTRETTO_EXPORT Token {
   Token(const Token&);
   ~Token();
   static base::expected<Token, std::string> random();
+  // Generates |count| tokens with a single call into the library.
+  static base::expected<std::vector<Token>, std::string> random_batch(
+      size_t count);
   base::expected<BlindedToken, std::string> blind();
+  // Blinds |tokens| with a single call into the library, the blinded tokens
+  // are returned in the same order.
+  static base::expected<std::vector<BlindedToken>, std::string> blind_batch(
+      const std::vector<Token>& tokens);
   static base::expected<Token, std::string> decode_base64(const std::string);
   base::expected<std::string, std::string> encode_base64() const;
 